@@ -0,0 +1,90 @@
+# Generate AircraftData.hpp from the aircraft definitions, run as a script:
+#   cmake -DINPUT=<definitions> -DOUTPUT=<header> -P GenerateAircraftData.cmake
+# Each line of the definitions holds the name, texture ID, category and speed of one aircraft type, '#' starts a
+# comment. The header gets the list of type names for Aircraft::Type and one constexpr array per column.
+
+if (NOT INPUT OR NOT OUTPUT)
+  message(FATAL_ERROR "GenerateAircraftData.cmake needs INPUT and OUTPUT")
+endif()
+
+file(STRINGS "${INPUT}" lines)
+
+set(count 0)
+set(types "")
+set(names "")
+set(textures "")
+set(categories "")
+set(speeds "")
+foreach (line IN LISTS lines)
+  string(REGEX REPLACE "#.*$" "" line "${line}")
+  string(STRIP "${line}" line)
+  if (line STREQUAL "")
+    continue()
+  endif()
+
+  if (NOT line MATCHES "^([A-Za-z_][A-Za-z0-9_]*)[ \t]+([A-Za-z_][A-Za-z0-9_]*)[ \t]+([A-Za-z_][A-Za-z0-9_]*)[ \t]+([0-9]+(\\.[0-9]+)?)$")
+    message(FATAL_ERROR "${INPUT}: invalid aircraft definition '${line}'")
+  endif()
+  set(name "${CMAKE_MATCH_1}")
+  set(texture "${CMAKE_MATCH_2}")
+  set(category "${CMAKE_MATCH_3}")
+  set(speed "${CMAKE_MATCH_4}")
+  # Speeds are written as float literals.
+  if (NOT speed MATCHES "\\.")
+    set(speed "${speed}.")
+  endif()
+
+  string(APPEND types " X(${name})")
+  string(APPEND names "    \"${name}\",\n")
+  string(APPEND textures "    Textures::${texture},\n")
+  string(APPEND categories "    Category::${category},\n")
+  string(APPEND speeds "    ${speed}f,\n")
+  math(EXPR count "${count} + 1")
+endforeach()
+
+if (count EQUAL 0)
+  message(FATAL_ERROR "${INPUT}: no aircraft defined")
+endif()
+
+file(WRITE "${OUTPUT}" "// Generated from ${INPUT} by GenerateAircraftData.cmake, edit the definitions instead.
+#ifndef AIRCRAFTDATA_HPP
+#define AIRCRAFTDATA_HPP
+
+// Include project header files
+#include \"ResourceIdentifiers.hpp\"
+#include \"Category.hpp\"
+
+// Calls X(name) for every aircraft type, in the order of the definitions.
+#define AIRCRAFT_TYPES(X)${types}
+
+/**
+ * Properties of every aircraft type, indexed by Aircraft::Type.
+ */
+namespace AircraftData
+{
+  // Number of aircraft types.
+  constexpr int Count = ${count};
+
+  // Name of each aircraft type, as levels refer to it.
+  constexpr const char* Names[Count] =
+  {
+${names}  };
+
+  // Texture each aircraft type is drawn with.
+  constexpr Textures::ID TextureIds[Count] =
+  {
+${textures}  };
+
+  // Category of each aircraft type.
+  constexpr unsigned int Categories[Count] =
+  {
+${categories}  };
+
+  // Speed each aircraft type flies at when steered.
+  constexpr float Speeds[Count] =
+  {
+${speeds}  };
+}
+
+#endif // AIRCRAFTDATA_HPP
+")
@@ -4,26 +4,56 @@
 // Include project header files
 #include "Entity.hpp"
 #include "ResourceIdentifiers.hpp"
+#include "AircraftData.hpp"
 
 // Include C++ standard headers.
 #include <SFML/Graphics/Sprite.hpp>
 
+// Forward declaration of ProjectileSystem and SoundPlayer class.
+class ProjectileSystem;
+class SoundPlayer;
+
 /**
  * Aircraft class represents all aircraft in the game which inherits the Entity class.
  */
 class Aircraft : public Entity
 {
  public:
-  // Store all types of aircraft by enum.
+  // Store all types of aircraft by enum, generated from the aircraft definitions.
   enum Type
   {
-    Eagle,
-    Raptor,
+#define AIRCRAFT_TYPE_ENUMERATOR(name) name,
+    AIRCRAFT_TYPES(AIRCRAFT_TYPE_ENUMERATOR)
+#undef AIRCRAFT_TYPE_ENUMERATOR
+    TypeCount
+  };
+
+ public:
+  // A struct indicates the simulation state of an aircraft at one point in time.
+  struct State
+  {
+    Vector2s			position;
+    Vector2s			velocity;
+    sf::Time			fireCountdown;
+    bool				isFiring;
   };
 
  public:
   // Constructor of the Aircraft class which using a Type(enum) and a const TextureHolder object.
   explicit  Aircraft(Type type, const TextureHolder& textures);
+  // Request to fire during the current tick.
+  void		fire();
+  // Launch the projectiles requested by fire() once the fire interval has passed, with gunfire if sounds are given.
+  void		launchProjectiles(sf::Time dt, ProjectileSystem& projectiles, SoundPlayer* sounds);
+  // Get the type of the aircraft.
+  Type		getType() const;
+  // Override the category of the type(e.g. a Raptor flying on the player's side).
+  void		setCategory(unsigned int category);
+  // Get the speed the aircraft flies at when steered.
+  Scalar	getMaxSpeed() const;
+  // Save and restore the simulation state.
+  void		saveState(State& state) const;
+  void		restoreState(const State& state);
 
  private:
   // Override drawCurrent method from SceneNode class to draw the current Aircraft object.
@@ -31,11 +61,22 @@ class Aircraft : public Entity
 
   // Returns the category of the game object.
   unsigned int	getCategory() const override;
+  // Add the world-space bounds of the aircraft as a collision body.
+  void		collectCurrentBodies(CollisionSystem& collisions) override;
 
  private:
   Type				    mType;
+  // Category of the aircraft, the one of its type unless overridden.
+  unsigned int			mCategory;
   // Sprite of each Aircraft object to render.
   sf::Sprite			mSprite;
+  // A bool value indicates whether the aircraft fires during the current tick.
+  bool				mIsFiring;
+  // Time left until the aircraft can fire again.
+  sf::Time			mFireCountdown;
 };
 
+// Maps the aircraft type to the corresponding texture ID.
+Textures::ID	toTextureID(Aircraft::Type type);
+
 #endif // AIRCRAFT_HPP
\ No newline at end of file
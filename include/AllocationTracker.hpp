@@ -0,0 +1,69 @@
+#ifndef ALLOCATIONTRACKER_HPP
+#define ALLOCATIONTRACKER_HPP
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+
+// Include C++ standard headers.
+#include <cstddef>
+
+/**
+ * This class counts heap allocations made by the main thread, per frame and per zone of the frame.
+ * Counting is opt-in: the global new/delete hooks are only compiled when TRACK_ALLOCATIONS is defined
+ * (CMake option SPACESHOOTER_TRACK_ALLOCATIONS), otherwise every counter stays at zero.
+ */
+class AllocationTracker
+{
+ public:
+  // A struct indicates how many allocations were made and how many bytes they requested.
+  struct Counters
+  {
+    // Constructor of the Counters struct.
+    Counters();
+
+    std::size_t			allocations;
+    std::size_t			bytes;
+  };
+
+  // Use enum to represent each zone of a frame we want to measure separately.
+  enum Zone
+  {
+    None,
+    Input,
+    Update,
+    Render,
+    ZoneCount
+  };
+
+  /**
+   * This class marks the current thread as being inside a zone until it goes out of scope.
+   */
+  class ScopedZone : private sf::NonCopyable
+  {
+   public:
+    // Constructor which enters the zone.
+    explicit			ScopedZone(Zone zone);
+    // Destructor which returns to the previous zone.
+    ~ScopedZone();
+
+   private:
+    // The zone which was active before this one.
+    Zone				mPrevious;
+  };
+
+ public:
+  // Check whether the allocation hooks are compiled in.
+  static bool			isEnabled();
+  // Record one allocation of the current thread(called by the global operator new hooks).
+  static void			recordAllocation(std::size_t size);
+  // Get the counters of all allocations made by the current thread so far.
+  static Counters		getThreadCounters();
+  // Close the previous frame and start counting a new one(call once per real frame on the main thread).
+  static void			beginFrame();
+  // Get the counters of the last completed frame.
+  static Counters		getFrameCounters();
+  // Get the counters of one zone during the last completed frame.
+  static Counters		getZoneCounters(Zone zone);
+};
+
+#endif // ALLOCATIONTRACKER_HPP
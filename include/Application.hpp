@@ -6,12 +6,37 @@
 #include "ResourceIdentifiers.hpp"
 #include "Player.hpp"
 #include "StateStack.hpp"
+#include "FrameGovernor.hpp"
+#include "InputSampler.hpp"
+#include "FramePacer.hpp"
+#include "GlyphCache.hpp"
+#include "SoundPlayer.hpp"
+
+#ifdef STATIC_STATE_STACK
+#include "StaticStateStack.hpp"
+#include "TitleState.hpp"
+#include "MenuState.hpp"
+#include "GameState.hpp"
+#include "PauseState.hpp"
+#endif
 
 // Include our Third-Party SFML header
 #include <SFML/System/Time.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
 
+#ifdef STATIC_STATE_STACK
+// All game states known at compile time, stored in-place and dispatched without virtual calls.
+typedef StaticStateStack<4,
+                         StateBinding<States::Title, TitleState>,
+                         StateBinding<States::Menu, MenuState>,
+                         StateBinding<States::Game, GameState>,
+                         StateBinding<States::Pause, PauseState>>	ApplicationStateStack;
+#else
+// States created on demand by the factories registered in the StateStack.
+typedef StateStack	ApplicationStateStack;
+#endif
+
 /**
  *  Application class represents the game App manager which inherits sf::NonCopyable class so that Game
  *  class is non-copyable.
@@ -36,27 +61,62 @@ class Application
   void					updateStatistics(sf::Time dt);
   // Register all game states by initializing all the mStateStack member variable.
   void					registerStates();
+  // Rasterize the glyphs of every text the game shows before the first frame.
+  void					warmUpGlyphs();
 
  private:
   // A const sf::Time instance indicates time per frame.
   static const sf::Time	TimePerFrame;
+  // Maximum number of fixed time steps we run to catch up within one real frame.
+  static const std::size_t	MaxUpdatesPerFrame;
+  // Number of sound effects which can play at the same time.
+  static const std::size_t	SoundVoiceCount;
   // A window object that can serve as a target for 2D drawing.
   sf::RenderWindow		mWindow;
   // A TextureHolder object to hold all textures we need to build the game world.
   TextureHolder			mTextures;
   // A FontHolder object to hold all fonts we need to build the game world.
   FontHolder			mFonts;
+  // Glyphs declared by the states and rasterized at load time, counts glyph cache misses at runtime.
+  GlyphCache			mGlyphs;
+  // A SoundHolder object to hold all sound buffers(loaded before mSoundPlayer starts).
+  SoundHolder			mSounds;
+  // Plays all sound effects on a fixed pool of voices.
+  SoundPlayer			mSoundPlayer;
   // A Player object to help handle events and real time input.
   Player				mPlayer;
-  // A StateStack object indicates the game state stack.
-  StateStack			mStateStack;
+  // An InputSampler object samples the player's realtime keys on its own thread.
+  InputSampler			mInputSampler;
+  // A state stack object indicates the game state stack.
+  ApplicationStateStack	mStateStack;
+  // A FrameGovernor object decides how many updates run per frame and whether the frame is rendered.
+  FrameGovernor			mGovernor;
+  // A FramePacer object limits the frame rate to the target of the state on top of the stack.
+  FramePacer			mPacer;
   // Graphical text that can be drawn to a render target.
   sf::Text				mStatisticsText;
+  // A bool value indicates whether the window has to be drawn again even if no state changed.
+  bool					mForceRedraw;
   // A const sf::Time instance indicates the interval time since last update(nearly 1 second in our program).
   sf::Time				mStatisticsUpdateTime;
   // std::size_t can store the maximum size of a theoretically possible object of any type (including array).
   // Here we store total frames per second here.
   std::size_t			mStatisticsNumFrames;
+  // Total time spent in update() since the statistics were last shown.
+  sf::Time				mStatisticsUpdateCost;
+  // Number of update() calls since the statistics were last shown.
+  std::size_t			mStatisticsNumUpdates;
+  // A bool value indicates whether input was consumed which has not been displayed yet.
+  bool					mHasUndisplayedInput;
+  // Sample time of the oldest input which has not been displayed yet.
+  sf::Time				mUndisplayedInputTime;
+  // Total and worst input-to-photon latency since the statistics were last shown.
+  sf::Time				mStatisticsLatency;
+  sf::Time				mStatisticsMaxLatency;
+  // Number of latency measurements since the statistics were last shown.
+  std::size_t			mStatisticsNumLatencies;
+  // CPU time the process used since the statistics were last shown.
+  sf::Time				mStatisticsCpuTime;
 };
 
 #endif // APPLICATION_HPP
\ No newline at end of file
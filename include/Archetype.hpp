@@ -0,0 +1,95 @@
+#ifndef ARCHETYPE_HPP
+#define ARCHETYPE_HPP
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+
+// Include C++ standard headers.
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// A bit mask with one bit set per component type(the bit is the component's Id).
+typedef std::uint32_t ComponentMask;
+
+// Maximum number of component types, one per bit of ComponentMask.
+static const std::size_t MaxComponentTypes = 32;
+
+/**
+ * A struct indicates a handle to one entity. The index is the entity's slot in the registry, the generation tells
+ * a live entity from an earlier one which used the same slot.
+ */
+struct EntityId
+{
+  std::uint32_t		index;
+  std::uint32_t		generation;
+};
+
+/**
+ * Computes the ComponentMask of a list of component types at compile time(recursion ends with an empty list).
+ * Every component type has a unique static Id below MaxComponentTypes.
+ */
+template <typename... Components>
+struct ComponentMaskOf;
+
+template <>
+struct ComponentMaskOf<>
+{
+  static const ComponentMask value = 0;
+};
+
+template <typename First, typename... Rest>
+struct ComponentMaskOf<First, Rest...>
+{
+  static_assert(First::Id < MaxComponentTypes, "Component Id must fit into a ComponentMask");
+  static const ComponentMask value = (ComponentMask(1) << First::Id) | ComponentMaskOf<Rest...>::value;
+};
+
+/**
+ * This class stores every entity which has exactly one set of components. Each component type of the set has its
+ * own densely packed column of raw bytes, row i of every column belongs to the i-th entity, so systems iterate
+ * plain arrays. Components are trivially copyable, which lets rows be moved with memcpy. Removing a row moves the
+ * last row into it, so the columns stay dense.
+ */
+class Archetype : private sf::NonCopyable
+{
+ public:
+  // Constructor, componentSizes gives the size of every component type by Id.
+  Archetype(ComponentMask mask, const std::array<std::size_t, MaxComponentTypes>& componentSizes);
+  // Get the set of component types stored.
+  ComponentMask			getMask() const;
+  // Get the number of rows(entities).
+  std::size_t			getSize() const;
+  // Reserve room for rows, so that adding up to that many never reallocates.
+  void					reserve(std::size_t rows);
+  // Add a row for an entity, its components are zero until written.
+  std::size_t			pushBack(EntityId entity);
+  // Remove a row by moving the last row into it, returns whether a row moved and which entity it holds.
+  bool					swapRemove(std::size_t row, EntityId& moved);
+  // Remove every row.
+  void					clear();
+  // Copy every row of another archetype of the same set of component types.
+  void					assign(const Archetype& other);
+  // Get the entity of every row.
+  const EntityId*		getEntities() const;
+  // Get the column of one component type(which must be part of the set).
+  void*					getColumn(std::size_t componentId);
+  const void*			getColumn(std::size_t componentId) const;
+  // Get the component of one component type in one row.
+  void*					getComponent(std::size_t componentId, std::size_t row);
+  // Get the size in bytes of one component type(0 if not part of the set).
+  std::size_t			getComponentSize(std::size_t componentId) const;
+
+ private:
+  // Set of component types stored.
+  ComponentMask								mMask;
+  // Entity of every row.
+  std::vector<EntityId>						mEntities;
+  // Size of each component type by Id, 0 for the types which are not part of the set.
+  std::array<std::size_t, MaxComponentTypes>	mSizes;
+  // Column of each component type by Id, empty for the types which are not part of the set.
+  std::array<std::vector<unsigned char>, MaxComponentTypes>	mColumns;
+};
+
+#endif // ARCHETYPE_HPP
@@ -0,0 +1,117 @@
+#ifndef BACKGROUNDSTREAMER_HPP
+#define BACKGROUNDSTREAMER_HPP
+
+// Include project header files
+#include "SceneNode.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Config.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+// Include C++ standard headers.
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstddef>
+
+// Forward declaration
+namespace sf
+{
+  class Image;
+}
+
+/**
+ * This class draws an endless background out of a fixed ring of chunks, each as wide as the view and stacked
+ * upward from an origin. The chunks around the view and one chunk ahead of the scroll direction are kept;
+ * a chunk which falls behind the view hands its slot(pixel buffer and texture) over to the next chunk needed.
+ * The pixels of a chunk are generated on a background thread, the main thread only uploads them into the slot's
+ * texture, so the level can be arbitrarily long while memory stays at chunkCount chunks.
+ * Positions are world coordinates, the node itself must not be transformed.
+ */
+class BackgroundStreamer : public SceneNode
+{
+ public:
+  // Constructor which fills the chunks visible in area before returning and starts the background thread.
+  BackgroundStreamer(const sf::Image& tile, sf::Vector2u chunkSize, float originY, std::size_t chunkCount,
+                     const sf::FloatRect& area);
+  // Destructor which stops the background thread.
+  ~BackgroundStreamer();
+  // Set the area the view currently shows, the chunks are requested from it on the next update.
+  void				setVisibleArea(const sf::FloatRect& area);
+  // Switch requesting the chunk ahead of the view on or off(on by default).
+  void				setPrefetching(bool isPrefetching);
+  // Hand the textures of all slots over(the node must not be drawn afterwards).
+  void				releaseTextures(std::vector<std::unique_ptr<sf::Texture>>& textures);
+
+ private:
+  // Use enum to represent the progress of a slot.
+  enum SlotState
+  {
+    Free,
+    Pending,
+    Generating,
+    Generated,
+    Ready,
+  };
+
+  // A struct indicates one slot of the ring which holds one chunk.
+  struct Slot
+  {
+    // Index of the chunk the slot holds or is about to hold(0 is the chunk right above the origin).
+    long						chunkIndex;
+    // Progress of the slot.
+    SlotState					state;
+    // RGBA pixels written by the background thread.
+    std::vector<sf::Uint8>		pixels;
+    // Texture the pixels are uploaded into.
+    std::unique_ptr<sf::Texture>	texture;
+    // Sprite placing the texture in the world.
+    sf::Sprite					sprite;
+  };
+
+ private:
+  // Request the chunks needed around the visible area and upload those which are generated.
+  void				updateCurrent(sf::Time dt) override;
+  // Draw every uploaded chunk.
+  void				drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+  // Hand a slot over to each needed chunk which has none, recycling the slots of chunks no longer needed.
+  bool				requestChunks();
+  // Upload the pixels of one generated slot into its texture.
+  void				uploadChunk(Slot& slot);
+  // Write the pixels of one chunk.
+  void				generateChunk(long chunkIndex, std::vector<sf::Uint8>& pixels) const;
+  // Get the index of the chunk covering a y coordinate.
+  long				getChunkIndex(float y) const;
+  // Main loop of the background thread.
+  void				run();
+
+ private:
+  // RGBA pixels of the tile the chunks are filled with(read only after construction).
+  std::vector<sf::Uint8>		mTilePixels;
+  // Size of the tile in pixels.
+  sf::Vector2u				mTileSize;
+  // Size of every chunk in pixels(and world units).
+  sf::Vector2u				mChunkSize;
+  // Y coordinate of the bottom of chunk 0.
+  float						mOriginY;
+  // Area the view currently shows.
+  sf::FloatRect				mVisibleArea;
+  // A bool value indicates whether the chunk ahead of the view is requested too.
+  bool						mPrefetching;
+  // Ring of slots.
+  std::vector<Slot>			mSlots;
+  // Protects the chunk index and state of every slot(also locked while drawing).
+  mutable std::mutex		mMutex;
+  // Wakes the background thread when a slot becomes pending or when it has to stop.
+  std::condition_variable	mCondition;
+  // A bool value indicates whether the background thread keeps running.
+  bool						mRunning;
+  // The background thread generating the chunks.
+  std::thread				mThread;
+};
+
+#endif // BACKGROUNDSTREAMER_HPP
@@ -15,6 +15,8 @@ namespace Category
     PlayerAircraft		= 1 << 1,
     AlliedAircraft		= 1 << 2,
     EnemyAircraft		= 1 << 3,
+    AlliedProjectile	= 1 << 4,
+    EnemyProjectile		= 1 << 5,
   };
 }
 
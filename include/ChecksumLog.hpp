@@ -0,0 +1,34 @@
+#ifndef CHECKSUMLOG_HPP
+#define CHECKSUMLOG_HPP
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+
+// Include C++ standard headers.
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+
+/**
+ * This class writes the world checksum of every tick into a text file, one "tick checksum" line per tick. Two logs
+ * of the same input(two runs, or a replay and its original) are compared line by line with
+ * --compare-checksums, which reports the first tick where they diverge.
+ */
+class ChecksumLog : private sf::NonCopyable
+{
+ public:
+  // Constructor which creates(or truncates) the log file, throws if it cannot be opened.
+  explicit		ChecksumLog(const std::string& filename);
+  // Write the checksum of one tick.
+  void			write(std::size_t tick, std::uint64_t checksum);
+  // Compare two logs and report the first divergent tick, returns whether they are identical.
+  static bool	compare(const std::string& first, const std::string& second, std::ostream& out);
+
+ private:
+  // The log file.
+  std::ofstream	mFile;
+};
+
+#endif // CHECKSUMLOG_HPP
@@ -0,0 +1,56 @@
+#ifndef CLIENTAPPLICATION_HPP
+#define CLIENTAPPLICATION_HPP
+
+// Include project header files
+#include "ResourceHolder.hpp"
+#include "ResourceIdentifiers.hpp"
+#include "NetworkClient.hpp"
+#include "FramePacer.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+// Include C++ standard headers.
+#include <ostream>
+#include <vector>
+
+/**
+ * This class shows a game run by a GameServer: it draws the latest snapshot the server sent and simulates nothing
+ * itself. The bandwidth received is written every second.
+ */
+class ClientApplication : private sf::NonCopyable
+{
+ public:
+  // Constructor which opens the window and connects to the server.
+  ClientApplication(const sf::IpAddress& server, unsigned short port);
+  // Draw the received snapshots until the window is closed.
+  void						run(std::ostream& out);
+
+ private:
+  // Handle the events of the window.
+  void						processInput();
+  // Draw the latest snapshot.
+  void						render(const Snapshot& snapshot);
+
+ private:
+  // A window object that can serve as a target for 2D drawing.
+  sf::RenderWindow			mWindow;
+  // The textures of the aircraft and of the background.
+  TextureHolder				mTextures;
+  // The connection to the server.
+  NetworkClient				mClient;
+  // Limits the frame rate.
+  FramePacer				mPacer;
+  // Sprite repeating the background tile over the view.
+  sf::Sprite				mBackground;
+  // Sprite drawn once per aircraft.
+  sf::Sprite				mAircraft;
+  // Four vertices per projectile, drawn with one draw call.
+  std::vector<sf::Vertex>	mProjectiles;
+};
+
+#endif // CLIENTAPPLICATION_HPP
@@ -0,0 +1,23 @@
+#ifndef COLLISIONBENCHMARK_HPP
+#define COLLISIONBENCHMARK_HPP
+
+// Include C++ standard headers.
+#include <ostream>
+#include <cstddef>
+
+/**
+ * This class measures the collision broadphase on random scenes of 1k, 10k and 100k bodies and reports candidate
+ * pairs per second. Run the game with --benchmark-collisions to start it instead of the game.
+ */
+class CollisionBenchmark
+{
+ public:
+  // Measure every scene size and write the results.
+  static void		run(std::ostream& out);
+
+ private:
+  // Measure one scene size and write the result.
+  static void		measure(std::size_t bodyCount, std::ostream& out);
+};
+
+#endif // COLLISIONBENCHMARK_HPP
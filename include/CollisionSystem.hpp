@@ -0,0 +1,76 @@
+#ifndef COLLISIONSYSTEM_HPP
+#define COLLISIONSYSTEM_HPP
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+// Include C++ standard headers.
+#include <array>
+#include <vector>
+#include <cstddef>
+
+// Forward declaration of SceneNode class.
+class SceneNode;
+
+/**
+ * This class finds the pairs of game objects whose bounds overlap, as candidates for a narrowphase.
+ * Bodies are gathered every tick with their world-space bounds and category. The broadphase sorts them along
+ * the x axis and sweeps once, comparing each body only with the following ones whose x interval overlaps its
+ * own(sweep and prune). Only pairs whose categories were allowed to interact are reported, and bodies which
+ * interact with nothing are not even added.
+ */
+class CollisionSystem : private sf::NonCopyable
+{
+ public:
+  // A struct indicates one collidable body.
+  struct Body
+  {
+    // World-space bounding rectangle.
+    sf::FloatRect		bounds;
+    // Category of the body(one bit of Category::Type).
+    unsigned int		category;
+    // Categories the body interacts with.
+    unsigned int		interactions;
+    // Scene node the body belongs to.
+    SceneNode*			node;
+    // Index of the body inside its node(for nodes holding many bodies, like the ProjectileSystem).
+    std::size_t			index;
+  };
+
+  // A struct indicates two bodies which may collide, as indices into getBodies().
+  struct Pair
+  {
+    std::size_t			first;
+    std::size_t			second;
+  };
+
+ public:
+  // Constructor, no categories interact at first.
+  CollisionSystem();
+  // Let two categories interact(in both directions).
+  void						allowPair(unsigned int first, unsigned int second);
+  // Reserve room for bodies and cap the candidate pairs, so that a tick never allocates.
+  void						reserve(std::size_t bodies, std::size_t pairs);
+  // Remove every body.
+  void						clear();
+  // Add one body, ignored if its category interacts with nothing.
+  void						addBody(const sf::FloatRect& bounds, unsigned int category, SceneNode& node,
+                                    std::size_t index = 0);
+  // Sort the bodies along the x axis and sweep them to find all candidate pairs.
+  const std::vector<Pair>&	findCandidatePairs();
+  // Get the bodies added since the last clear(sorted along the x axis after findCandidatePairs()).
+  const std::vector<Body>&	getBodies() const;
+
+ private:
+  // Categories each category bit interacts with.
+  std::array<unsigned int, 32>	mInteractions;
+  // Bodies added since the last clear.
+  std::vector<Body>			mBodies;
+  // Candidate pairs found by the last broadphase.
+  std::vector<Pair>			mPairs;
+  // Maximum number of candidate pairs found by one broadphase(0 means no limit).
+  std::size_t				mPairCapacity;
+};
+
+#endif // COLLISIONSYSTEM_HPP
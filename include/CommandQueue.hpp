@@ -5,14 +5,17 @@
 #include "Command.hpp"
 
 // Include C++ standard headers.
-#include <queue>
+#include <vector>
 
 /**
- * This class represents a queue of Command objects.
+ * This class represents a queue of Command objects. Commands are kept in a vector which is reused once
+ * it has been drained, so after warm-up pushing and popping commands never touches the heap.
  */
 class CommandQueue
 {
  public:
+  // Constructor.
+  CommandQueue();
   // Push one command into the CommandQueue object.
   void						push(const Command& command);
   // Pop one command from the CommandQueue object.
@@ -21,8 +24,10 @@ class CommandQueue
   bool						isEmpty() const;
 
  private:
-  // A std::queue<Command> object which stores all commands by a queue.
-  std::queue<Command>		mQueue;
+  // A std::vector<Command> object which stores all commands in the order they were pushed.
+  std::vector<Command>		mQueue;
+  // Index of the front command inside mQueue.
+  std::size_t				mFront;
 };
 
 #endif // COMMANDQUEUE_HPP
\ No newline at end of file
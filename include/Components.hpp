@@ -0,0 +1,84 @@
+#ifndef COMPONENTS_HPP
+#define COMPONENTS_HPP
+
+// Include project header files
+#include "Scalar.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Graphics/Rect.hpp>
+
+// Include C++ standard headers.
+#include <cstddef>
+
+// Forward declaration
+namespace sf
+{
+  class Texture;
+}
+
+/**
+ * This namespace holds the component types of the entity-component-system. Every component is a trivially copyable
+ * struct whose static Id(below MaxComponentTypes) is unique, it selects the component's bit in a ComponentMask.
+ */
+namespace Components
+{
+  // World position of an entity.
+  struct Position
+  {
+    static const std::size_t	Id = 0;
+    Scalar						x;
+    Scalar						y;
+  };
+
+  // Velocity of an entity, applied to its position every tick.
+  struct Velocity
+  {
+    static const std::size_t	Id = 1;
+    Scalar						x;
+    Scalar						y;
+  };
+
+  // Part of a texture drawn centered on the entity's position.
+  struct Sprite
+  {
+    static const std::size_t	Id = 2;
+    const sf::Texture*			texture;
+    sf::IntRect					textureRect;
+    // Rotation in degrees.
+    float						rotation;
+  };
+
+  // Axis aligned collision box centered on the entity's position.
+  struct Collider
+  {
+    static const std::size_t	Id = 3;
+    float						halfWidth;
+    float						halfHeight;
+    // Category of the body(one bit of Category::Type).
+    unsigned int				category;
+  };
+
+  // Weapon firing a ring of projectiles in every direction.
+  struct RingWeapon
+  {
+    static const std::size_t	Id = 4;
+    // Seconds left until the next ring, and between two rings.
+    Scalar						countdown;
+    Scalar						interval;
+    Scalar						projectileSpeed;
+    int							projectileCount;
+  };
+
+  // Exhaust emitter behind an entity.
+  struct Exhaust
+  {
+    static const std::size_t	Id = 5;
+    // Distance behind the entity's position, along its rotation.
+    float						offset;
+    // Seconds accumulated since the last particle, and between two particles.
+    float						accumulated;
+    float						interval;
+  };
+}
+
+#endif // COMPONENTS_HPP
@@ -0,0 +1,32 @@
+#ifndef EMITTERNODE_HPP
+#define EMITTERNODE_HPP
+
+// Include project header files
+#include "SceneNode.hpp"
+#include "ParticleSystem.hpp"
+
+/**
+ * This class represents a scene node which spawns particles at its world position at a constant rate, attached
+ * to a game object(e.g. an aircraft) so that the particles follow it. The particles are held by a ParticleSystem,
+ * the emitter itself draws nothing.
+ */
+class EmitterNode : public SceneNode
+{
+ public:
+  // Constructor.
+  EmitterNode(ParticleSystem& particles, float particlesPerSecond);
+
+ private:
+  // Spawn the particles due during this frame.
+  void				updateCurrent(sf::Time dt) override;
+
+ private:
+  // The system the particles are added to.
+  ParticleSystem&	mParticles;
+  // Time between two particles.
+  sf::Time			mInterval;
+  // Time accumulated since the last particle.
+  sf::Time			mAccumulatedTime;
+};
+
+#endif // EMITTERNODE_HPP
@@ -3,33 +3,47 @@
 
 // Include project header files
 #include "SceneNode.hpp"
+#include "Scalar.hpp"
 
 /**
  * Entity class contains the data and functionality that all different kinds of entities have in common.
- * Entity class also inherits the SceneNode class.
+ * Entity class also inherits the SceneNode class. Its position and velocity are simulation state(Scalar), the
+ * transform of the node only follows the position, so entities are placed with setSimulatedPosition().
  */
 class Entity : public SceneNode
 {
  public:
-  // Set current Entity object's velocity by a sf::Vector2f object.
-  void				setVelocity(sf::Vector2f velocity);
-  // Set current Entity object's velocity by two float.
-  void				setVelocity(float vx, float vy);
+  // Constructor.
+  Entity();
+  // Set current Entity object's velocity by a Vector2s object.
+  void				setVelocity(Vector2s velocity);
+  // Set current Entity object's velocity by two Scalar.
+  void				setVelocity(Scalar vx, Scalar vy);
   // Accelerate current Entity object.
-  void				accelerate(sf::Vector2f velocity);
-  void				accelerate(float vx, float vy);
+  void				accelerate(Vector2s velocity);
+  void				accelerate(Scalar vx, Scalar vy);
 
-  // Get current Entity object's velocity as a sf::Vector2f object. This method wont modify any member variables.
-  sf::Vector2f		getVelocity() const;
+  // Get current Entity object's velocity as a Vector2s object. This method wont modify any member variables.
+  Vector2s			getVelocity() const;
+  // Place current Entity object(relative to its parent), the transform follows.
+  void				setSimulatedPosition(Vector2s position);
+  // Get current Entity object's position(relative to its parent).
+  Vector2s			getSimulatedPosition() const;
 
  private:
   // updateCurrent method from SceneNode class to update the movement of
   // the current Entity object according to the delta time.
   void		updateCurrent(sf::Time dt) override;
+  // Add the position, velocity and category to a checksum.
+  void		hashCurrentState(StateHash& hash) override;
+  // Write the category and world position into a snapshot.
+  void		writeCurrentSnapshot(Snapshot& snapshot) override;
 
  private:
-  // A sf::Vector2f object which represents the velocity of the current Entity object.
-  sf::Vector2f		mVelocity;
+  // A Vector2s object which represents the position of the current Entity object.
+  Vector2s			mPosition;
+  // A Vector2s object which represents the velocity of the current Entity object.
+  Vector2s			mVelocity;
 };
 
-#endif // ENTITY_HPP
\ No newline at end of file
+#endif // ENTITY_HPP
@@ -0,0 +1,144 @@
+#ifndef ENTITYREGISTRY_HPP
+#define ENTITYREGISTRY_HPP
+
+// Include project header files
+#include "Archetype.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+
+// Include C++ standard headers.
+#include <array>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * This class owns every entity of an entity-component-system and their components. Entities with the same set of
+ * component types share one Archetype, so the components a system needs are densely packed arrays. A query over
+ * a set of component types remembers the archetypes matching it(and is extended when a new archetype appears),
+ * so iterating never searches. A component type is a trivially copyable struct with a unique static Id.
+ * Destroying an entity only flags it, flagged entities are removed together by removeDestroyed(), so systems
+ * may destroy entities while iterating; entities must not be created or changed while iterating.
+ */
+class EntityRegistry : private sf::NonCopyable
+{
+ public:
+  // The entities and components of a registry at one point in time(defined below).
+  struct State;
+
+ public:
+  // Constructor.
+  EntityRegistry();
+  // Reserve room for entities, so that creating up to that many never reallocates the registry itself.
+  void					reserve(std::size_t count);
+  // Reserve rows in the archetype of exactly these component types(creating it if needed).
+  template <typename... Components>
+  void					reserveArchetype(std::size_t count);
+  // Create an entity with the given components.
+  template <typename... Components>
+  EntityId				create(const Components&... components);
+  // Flag an entity for removal by removeDestroyed()(ignored if it is not alive or already flagged).
+  void					destroy(EntityId entity);
+  // Check whether an entity is flagged for removal.
+  bool					isDestroyed(EntityId entity) const;
+  // Remove every flagged entity.
+  void					removeDestroyed();
+  // Remove every entity(the reserved room and the archetypes are kept).
+  void					clear();
+  // Copy every entity and its components into a saved state.
+  void					saveState(State& state) const;
+  // Bring every entity and its components back from a saved state.
+  void					restoreState(const State& state);
+  // Check whether an entity handle refers to a live entity.
+  bool					isAlive(EntityId entity) const;
+  // Get the handle of the live entity in a slot.
+  EntityId				getEntity(std::uint32_t index) const;
+  // Get the number of live entities.
+  std::size_t			getCount() const;
+  // Check whether an entity has a component type.
+  template <typename Component>
+  bool					has(EntityId entity) const;
+  // Get one component of an entity, which must have it.
+  template <typename Component>
+  Component&			get(EntityId entity);
+  // Add a component to an entity(or overwrite it), which moves it into another archetype.
+  template <typename Component>
+  void					add(EntityId entity, const Component& component);
+  // Remove a component from an entity, which moves it into another archetype.
+  template <typename Component>
+  void					remove(EntityId entity);
+  // Call function(count, entities, columns...) once per non-empty archetype having all the component types.
+  template <typename... Components, typename Function>
+  void					each(Function function);
+
+ private:
+  // A struct indicates where the entity of one slot lives.
+  struct Record
+  {
+    // Generation of the slot, increased whenever its entity is removed.
+    std::uint32_t		generation;
+    // Archetype and row of the entity.
+    std::size_t			archetype;
+    std::size_t			row;
+    // A bool value indicates whether the slot holds an entity.
+    bool				alive;
+    // A bool value indicates whether the entity is flagged for removal.
+    bool				destroyed;
+  };
+
+  // A struct indicates the archetypes matching one set of component types.
+  struct Query
+  {
+    ComponentMask				mask;
+    std::vector<std::size_t>	archetypes;
+  };
+
+ private:
+  // Remember the size of a component type.
+  template <typename Component>
+  void					registerComponent();
+  // Get the archetype of a set of component types, creating it if needed.
+  std::size_t			findArchetype(ComponentMask mask);
+  // Get the query of a set of component types, creating it if needed.
+  const Query&			findQuery(ComponentMask mask);
+  // Take a free slot(or a new one) for a new entity.
+  EntityId				allocateSlot();
+  // Move an entity into the archetype of another set of component types, keeping the shared components.
+  void					moveEntity(EntityId entity, ComponentMask mask);
+  // Remove the row of an entity from its archetype, fixing the record of the entity moved into it.
+  void					removeRow(std::size_t archetype, std::size_t row);
+
+ private:
+  // Size of each component type by Id, 0 until the type is registered.
+  std::array<std::size_t, MaxComponentTypes>	mComponentSizes;
+  // Every archetype created so far.
+  std::vector<std::unique_ptr<Archetype>>	mArchetypes;
+  // Every query used so far.
+  std::vector<Query>						mQueries;
+  // Record of every slot.
+  std::vector<Record>						mRecords;
+  // Slots without an entity, reused first.
+  std::vector<std::uint32_t>				mFreeSlots;
+  // Entities flagged for removal.
+  std::vector<EntityId>						mDestroyed;
+  // Number of live entities.
+  std::size_t								mCount;
+};
+
+/**
+ * A struct indicates the entities and components of a registry at one point in time, saved by saveState(). Every
+ * member is plain data copied as a whole, and the room of a state is reused by the next save.
+ */
+struct EntityRegistry::State
+{
+  std::vector<Record>						records;
+  std::vector<std::uint32_t>				freeSlots;
+  std::size_t								count;
+  // A copy of each archetype, by the index of the archetype in the registry.
+  std::vector<std::unique_ptr<Archetype>>	archetypes;
+};
+
+#include "EntityRegistry.inl"
+#endif // ENTITYREGISTRY_HPP
@@ -0,0 +1,149 @@
+// Include C++ standard headers.
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * Reserve rows in the archetype of exactly these component types, creating it if needed, so that creating up to
+ * that many entities of the archetype never reallocates.
+ * @tparam Components indicates the component types of the archetype
+ * @param count a std::size_t indicates the number of rows.
+ */
+template <typename... Components>
+void EntityRegistry::reserveArchetype(std::size_t count)
+{
+  int registered[] = { 0, (registerComponent<Components>(), 0)... };
+  (void) registered;
+
+  mArchetypes[findArchetype(ComponentMaskOf<Components...>::value)] -> reserve(count);
+}
+
+/**
+ * Create an entity with the given components.
+ * @tparam Components indicates the component types of the entity(each at most once)
+ * @param components indicates the initial value of each component.
+ * @return an EntityId indicates the new entity.
+ */
+template <typename... Components>
+EntityId EntityRegistry::create(const Components&... components)
+{
+  int registered[] = { 0, (registerComponent<Components>(), 0)... };
+  (void) registered;
+
+  std::size_t archetypeIndex = findArchetype(ComponentMaskOf<Components...>::value);
+  Archetype& archetype = *mArchetypes[archetypeIndex];
+
+  EntityId entity = allocateSlot();
+  std::size_t row = archetype.pushBack(entity);
+  Record& record = mRecords[entity.index];
+  record.archetype = archetypeIndex;
+  record.row = row;
+
+  int written[] = { 0, (std::memcpy(archetype.getComponent(Components::Id, row), &components, sizeof(Components)),
+                        0)... };
+  (void) written;
+  return entity;
+}
+
+/**
+ * Check whether an entity has a component type.
+ * @tparam Component indicates the component type
+ * @param entity an EntityId indicates a live entity.
+ * @return a bool value indicates whether the entity has a component of that type.
+ */
+template <typename Component>
+bool EntityRegistry::has(EntityId entity) const
+{
+  assert(isAlive(entity));
+  return (mArchetypes[mRecords[entity.index].archetype] -> getMask() & ComponentMaskOf<Component>::value) != 0;
+}
+
+/**
+ * Get one component of an entity. The reference is valid until entities are created, changed or removed.
+ * @tparam Component indicates the component type
+ * @param entity an EntityId indicates a live entity which has the component.
+ * @return a reference to the component.
+ */
+template <typename Component>
+Component& EntityRegistry::get(EntityId entity)
+{
+  assert(isAlive(entity) && has<Component>(entity));
+
+  const Record& record = mRecords[entity.index];
+  return *static_cast<Component*>(mArchetypes[record.archetype] -> getComponent(Component::Id, record.row));
+}
+
+/**
+ * Add a component to an entity, which moves the entity into the archetype including that component type. If the
+ * entity has the component already, it is just overwritten.
+ * @tparam Component indicates the component type
+ * @param entity an EntityId indicates a live entity.
+ * @param component indicates the value of the component.
+ */
+template <typename Component>
+void EntityRegistry::add(EntityId entity, const Component& component)
+{
+  registerComponent<Component>();
+  assert(isAlive(entity));
+
+  const Record& record = mRecords[entity.index];
+  ComponentMask mask = mArchetypes[record.archetype] -> getMask();
+  if (!(mask & ComponentMaskOf<Component>::value))
+    moveEntity(entity, mask | ComponentMaskOf<Component>::value);
+
+  get<Component>(entity) = component;
+}
+
+/**
+ * Remove a component from an entity, which moves the entity into the archetype without that component type.
+ * @tparam Component indicates the component type
+ * @param entity an EntityId indicates a live entity.
+ */
+template <typename Component>
+void EntityRegistry::remove(EntityId entity)
+{
+  assert(isAlive(entity));
+
+  const Record& record = mRecords[entity.index];
+  ComponentMask mask = mArchetypes[record.archetype] -> getMask();
+  if (mask & ComponentMaskOf<Component>::value)
+    moveEntity(entity, mask & ~ComponentMaskOf<Component>::value);
+}
+
+/**
+ * Call a function once per non-empty archetype having all the component types, with the number of rows, the entity
+ * of every row and one column per component type, e.g. function(std::size_t count, const EntityId* entities,
+ * Position* positions, Velocity* velocities). Entities may be destroyed inside, but not created or changed.
+ * @tparam Components indicates the component types every archetype must have
+ * @tparam Function indicates the type of the function
+ * @param function indicates the function called with the packed columns.
+ */
+template <typename... Components, typename Function>
+void EntityRegistry::each(Function function)
+{
+  const Query& query = findQuery(ComponentMaskOf<Components...>::value);
+  for (std::size_t archetypeIndex : query.archetypes)
+  {
+    Archetype& archetype = *mArchetypes[archetypeIndex];
+    if (archetype.getSize() == 0)
+      continue;
+
+    function(archetype.getSize(), archetype.getEntities(),
+             static_cast<Components*>(archetype.getColumn(Components::Id))...);
+  }
+}
+
+/**
+ * Remember the size of a component type, archetypes need it for their columns.
+ * @tparam Component indicates the component type
+ */
+template <typename Component>
+void EntityRegistry::registerComponent()
+{
+  static_assert(std::is_trivially_copyable<Component>::value, "Components must be trivially copyable");
+  static_assert(Component::Id < MaxComponentTypes, "Component Id must fit into a ComponentMask");
+
+  // Ensure that no two component types share an Id.
+  assert(mComponentSizes[Component::Id] == 0 || mComponentSizes[Component::Id] == sizeof(Component));
+  mComponentSizes[Component::Id] = sizeof(Component);
+}
@@ -0,0 +1,68 @@
+#ifndef ENTITYSYSTEMNODE_HPP
+#define ENTITYSYSTEMNODE_HPP
+
+// Include project header files
+#include "SceneNode.hpp"
+#include "EntityRegistry.hpp"
+#include "Components.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Graphics/Vertex.hpp>
+
+// Include C++ standard headers.
+#include <vector>
+#include <cstddef>
+
+/**
+ * This class puts the entities of an EntityRegistry into the scene graph. The scene graph only orders it among the
+ * other nodes, the entities themselves have no node: the update runs the movement system over the packed
+ * Position and Velocity columns, drawing renders every Sprite with one draw call per texture, and the collision
+ * bodies come from the Collider columns(the body index is the entity's slot). Positions are world coordinates,
+ * the node itself must not be transformed.
+ */
+class EntitySystemNode : public SceneNode
+{
+ public:
+  // Constructor.
+  EntitySystemNode();
+  // Get the registry of the entities.
+  EntityRegistry&		getRegistry();
+  // Reserve room for entities drawn with a texture, so that drawing them never allocates.
+  void					reserveTexture(const sf::Texture& texture, std::size_t count);
+  // Remove every entity flagged for removal and rewrite the quads.
+  void					removeDestroyed();
+  // Bring the entities back from a state saved by the registry and rewrite the quads.
+  void					restoreState(const EntityRegistry::State& state);
+  // Write the quad of every entity with a sprite into the batch of its texture(done by every update).
+  void					writeBatches();
+
+ private:
+  // Move the entities and write their quads.
+  void					updateCurrent(sf::Time dt) override;
+  // Add the collider of every entity as a collision body.
+  void					collectCurrentBodies(CollisionSystem& collisions) override;
+  // Add the position, velocity and category of every entity to a checksum.
+  void					hashCurrentState(StateHash& hash) override;
+  // Write the category and position of every entity into a snapshot.
+  void					writeCurrentSnapshot(Snapshot& snapshot) override;
+  // Draw the entities with one draw call per texture.
+  void					drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+  // Get the batch of a texture, creating it if needed.
+  std::vector<sf::Vertex>&	findBatch(const sf::Texture* texture);
+
+ private:
+  // A struct indicates the quads drawn with one texture.
+  struct Batch
+  {
+    const sf::Texture*			texture;
+    std::vector<sf::Vertex>		vertices;
+  };
+
+ private:
+  // The entities and their components.
+  EntityRegistry		mRegistry;
+  // One batch per texture used so far.
+  std::vector<Batch>	mBatches;
+};
+
+#endif // ENTITYSYSTEMNODE_HPP
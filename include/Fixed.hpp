@@ -0,0 +1,59 @@
+#ifndef FIXED_HPP
+#define FIXED_HPP
+
+// Include C++ standard headers.
+#include <cstdint>
+
+/**
+ * This class represents a signed fixed-point number with 16 fractional bits stored in a 64-bit integer(Q47.16).
+ * Every operation is plain integer arithmetic, so results are bit-identical whatever the compiler, optimization
+ * level or instruction set, unlike float arithmetic. Products and quotients are rounded toward zero. The range is
+ * large enough for world coordinates, as long as two coordinates are never multiplied with each other.
+ */
+class Fixed
+{
+ public:
+  // Number of fractional bits.
+  static const int			FractionBits = 16;
+  // Raw value of 1.
+  static const std::int64_t	One = std::int64_t(1) << FractionBits;
+
+ public:
+  // Default constructor, the value is undefined(like a float's) so that Fixed stays trivially copyable.
+  Fixed() = default;
+  // Constructor from an integer.
+  explicit					Fixed(int value);
+  // Build a number from its raw value.
+  static Fixed				fromRaw(std::int64_t raw);
+  // Build a number from a float or double, rounded to the nearest representable value.
+  static Fixed				fromFloat(float value);
+  static Fixed				fromDouble(double value);
+  // Get the raw value.
+  std::int64_t				getRaw() const;
+  // Convert the number into a float(for rendering).
+  float						toFloat() const;
+
+  Fixed&					operator+=(Fixed rhs);
+  Fixed&					operator-=(Fixed rhs);
+  Fixed&					operator*=(Fixed rhs);
+  Fixed&					operator/=(Fixed rhs);
+  Fixed						operator-() const;
+
+ private:
+  // Value times One.
+  std::int64_t				mRaw;
+};
+
+Fixed	operator+(Fixed lhs, Fixed rhs);
+Fixed	operator-(Fixed lhs, Fixed rhs);
+Fixed	operator*(Fixed lhs, Fixed rhs);
+Fixed	operator/(Fixed lhs, Fixed rhs);
+bool	operator==(Fixed lhs, Fixed rhs);
+bool	operator!=(Fixed lhs, Fixed rhs);
+bool	operator<(Fixed lhs, Fixed rhs);
+bool	operator<=(Fixed lhs, Fixed rhs);
+bool	operator>(Fixed lhs, Fixed rhs);
+bool	operator>=(Fixed lhs, Fixed rhs);
+
+#include "Fixed.inl"
+#endif // FIXED_HPP
@@ -0,0 +1,143 @@
+// Include C++ standard headers.
+#include <cassert>
+#include <cmath>
+
+/**
+ * Constructor of Fixed class from an integer.
+ * @param value an int indicates the value.
+ */
+inline Fixed::Fixed(int value)
+    : mRaw(std::int64_t(value) * One)
+{
+}
+
+/**
+ * Build a number from its raw value.
+ * @param raw a 64-bit integer indicates the value times One.
+ * @return a Fixed object indicates the number.
+ */
+inline Fixed Fixed::fromRaw(std::int64_t raw)
+{
+  Fixed number;
+  number.mRaw = raw;
+  return number;
+}
+
+/**
+ * Build a number from a float, rounded to the nearest representable value. The conversion is exact arithmetic
+ * followed by one rounding, so the same float always gives the same number.
+ * @param value a float indicates the value.
+ * @return a Fixed object indicates the number.
+ */
+inline Fixed Fixed::fromFloat(float value)
+{
+  return fromRaw(std::llround(static_cast<double>(value) * One));
+}
+
+/**
+ * Build a number from a double, rounded to the nearest representable value.
+ * @param value a double indicates the value.
+ * @return a Fixed object indicates the number.
+ */
+inline Fixed Fixed::fromDouble(double value)
+{
+  return fromRaw(std::llround(value * One));
+}
+
+/**
+ * Get the raw value.
+ * @return a 64-bit integer indicates the value times One.
+ */
+inline std::int64_t Fixed::getRaw() const
+{
+  return mRaw;
+}
+
+/**
+ * Convert the number into a float, e.g. for rendering.
+ * @return a float indicates the nearest float value.
+ */
+inline float Fixed::toFloat() const
+{
+  return static_cast<float>(static_cast<double>(mRaw) / One);
+}
+
+inline Fixed& Fixed::operator+=(Fixed rhs)
+{
+  mRaw += rhs.mRaw;
+  return *this;
+}
+
+inline Fixed& Fixed::operator-=(Fixed rhs)
+{
+  mRaw -= rhs.mRaw;
+  return *this;
+}
+
+inline Fixed& Fixed::operator*=(Fixed rhs)
+{
+  mRaw = mRaw * rhs.mRaw / One;
+  return *this;
+}
+
+inline Fixed& Fixed::operator/=(Fixed rhs)
+{
+  assert(rhs.mRaw != 0);
+  mRaw = mRaw * One / rhs.mRaw;
+  return *this;
+}
+
+inline Fixed Fixed::operator-() const
+{
+  return fromRaw(-mRaw);
+}
+
+inline Fixed operator+(Fixed lhs, Fixed rhs)
+{
+  return lhs += rhs;
+}
+
+inline Fixed operator-(Fixed lhs, Fixed rhs)
+{
+  return lhs -= rhs;
+}
+
+inline Fixed operator*(Fixed lhs, Fixed rhs)
+{
+  return lhs *= rhs;
+}
+
+inline Fixed operator/(Fixed lhs, Fixed rhs)
+{
+  return lhs /= rhs;
+}
+
+inline bool operator==(Fixed lhs, Fixed rhs)
+{
+  return lhs.getRaw() == rhs.getRaw();
+}
+
+inline bool operator!=(Fixed lhs, Fixed rhs)
+{
+  return lhs.getRaw() != rhs.getRaw();
+}
+
+inline bool operator<(Fixed lhs, Fixed rhs)
+{
+  return lhs.getRaw() < rhs.getRaw();
+}
+
+inline bool operator<=(Fixed lhs, Fixed rhs)
+{
+  return lhs.getRaw() <= rhs.getRaw();
+}
+
+inline bool operator>(Fixed lhs, Fixed rhs)
+{
+  return lhs.getRaw() > rhs.getRaw();
+}
+
+inline bool operator>=(Fixed lhs, Fixed rhs)
+{
+  return lhs.getRaw() >= rhs.getRaw();
+}
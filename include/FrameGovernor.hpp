@@ -0,0 +1,75 @@
+#ifndef FRAMEGOVERNOR_HPP
+#define FRAMEGOVERNOR_HPP
+
+// Include our Third-Party SFML header
+#include <SFML/System/Time.hpp>
+
+// Include C++ standard headers.
+#include <cstddef>
+
+/**
+ * This class decides how many fixed time steps the main loop runs per real frame, so that a slow update can
+ * never make the game fall further and further behind(the fixed-timestep "spiral of death").
+ * It caps the catch-up steps per frame and drops the simulation time beyond that cap, measures the cost of each
+ * update, and while updates eat most of the frame budget it enters a degraded mode in which non-critical work
+ * (rendering every frame) is done less often. States read isDegraded() to throttle their cosmetic simulation too.
+ */
+class FrameGovernor
+{
+ public:
+  // A struct indicates how often the governor had to step in.
+  struct Counters
+  {
+    // Constructor of the Counters struct.
+    Counters();
+
+    // Number of frames which hit the catch-up cap.
+    std::size_t			cappedFrames;
+    // Total simulation time dropped because of the cap.
+    sf::Time			droppedTime;
+    // Number of frames run in degraded mode.
+    std::size_t			degradedFrames;
+    // Number of renders skipped in degraded mode.
+    std::size_t			skippedRenders;
+    // Number of fixed steps run in degraded mode, where the states throttle their cosmetic simulation.
+    std::size_t			throttledSteps;
+  };
+
+ public:
+  // Constructor which takes the fixed time step and the maximum number of steps per frame.
+  FrameGovernor(sf::Time timePerFrame, std::size_t maxStepsPerFrame);
+  // Start a new real frame with the time elapsed since the previous one.
+  void				beginFrame(sf::Time elapsed);
+  // Check whether one more fixed step should run in the current frame.
+  bool				nextStep();
+  // Record how long the last fixed step took.
+  void				endStep(sf::Time cost);
+  // Check whether the current frame should be rendered.
+  bool				shouldRender();
+  // Check whether the governor is in degraded mode.
+  bool				isDegraded() const;
+  // Get the average cost of one fixed step.
+  sf::Time			getAverageStepCost() const;
+  // Get the counters which report how often the governor stepped in.
+  const Counters&	getCounters() const;
+
+ private:
+  // The fixed time step.
+  sf::Time			mTimePerFrame;
+  // Maximum number of fixed steps per real frame.
+  std::size_t		mMaxStepsPerFrame;
+  // Simulation time which still has to be run.
+  sf::Time			mAccumulated;
+  // Number of fixed steps run in the current frame.
+  std::size_t		mStepsThisFrame;
+  // Exponential moving average of the cost of one fixed step(in seconds).
+  float				mAverageStepCost;
+  // A bool value indicates whether the governor is in degraded mode.
+  bool				mDegraded;
+  // Number of frames since the last render in degraded mode.
+  std::size_t		mFramesSinceRender;
+  // How often the governor stepped in.
+  Counters			mCounters;
+};
+
+#endif // FRAMEGOVERNOR_HPP
@@ -0,0 +1,43 @@
+#ifndef FRAMEPACER_HPP
+#define FRAMEPACER_HPP
+
+// Include our Third-Party SFML header
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+
+/**
+ * This class limits the frame rate without burning a core. At the end of a frame it sleeps for most of the
+ * remaining frame time and only spins for the last fraction of a millisecond, where the scheduler's wake-up
+ * latency would make sleeping miss the deadline. The spin margin adapts to how much sleeps overshoot.
+ * It also measures the CPU time the whole process used per frame.
+ */
+class FramePacer
+{
+ public:
+  // Constructor.
+  FramePacer();
+  // Set the target frame rate(0 means no limit).
+  void				setTargetFrameRate(unsigned int framesPerSecond);
+  // Wait until the next frame is due and start it.
+  void				waitForNextFrame();
+  // Get the CPU time the process used during the last frame.
+  sf::Time			getLastFrameCpuTime() const;
+  // Get the CPU time the process used since it started(all threads).
+  static sf::Time	getProcessCpuTime();
+
+ private:
+  // The clock every deadline is measured with.
+  sf::Clock			mClock;
+  // Duration of one frame at the target frame rate(zero means no limit).
+  sf::Time			mFrameTime;
+  // When the current frame started.
+  sf::Time			mFrameStart;
+  // How long before the deadline we stop sleeping and start spinning.
+  sf::Time			mSpinTime;
+  // Process CPU time when the current frame started.
+  sf::Time			mFrameCpuStart;
+  // CPU time the process used during the last frame.
+  sf::Time			mLastFrameCpuTime;
+};
+
+#endif // FRAMEPACER_HPP
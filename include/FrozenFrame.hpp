@@ -0,0 +1,42 @@
+#ifndef FROZENFRAME_HPP
+#define FROZENFRAME_HPP
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+
+// Forward declaration of sf::RenderWindow class.
+namespace sf
+{
+  class RenderWindow;
+}
+
+/**
+ * This class keeps a copy of what the states below a pause-type state drew, so that they are drawn once when the
+ * pause-type state is pushed and then replaced by a single textured quad until the stack changes again.
+ */
+class FrozenFrame : private sf::NonCopyable
+{
+ public:
+  // Constructor.
+  FrozenFrame();
+  // Copy what was drawn to the window so far.
+  void				capture(const sf::RenderWindow& window);
+  // Draw the copied frame as one quad covering the default view.
+  void				draw(sf::RenderWindow& window) const;
+  // Forget the copied frame, the next draw has to capture it again.
+  void				invalidate();
+  // Check whether a copied frame is available.
+  bool				isValid() const;
+
+ private:
+  // Texture holding the copied frame(window pixel size).
+  sf::Texture		mTexture;
+  // Sprite drawing mTexture stretched over the default view.
+  sf::Sprite		mSprite;
+  // A bool value indicates whether mTexture holds an up to date frame.
+  bool				mValid;
+};
+
+#endif // FROZENFRAME_HPP
@@ -0,0 +1,114 @@
+#ifndef GAMESERVER_HPP
+#define GAMESERVER_HPP
+
+// Include project header files
+#include "ResourceHolder.hpp"
+#include "ResourceIdentifiers.hpp"
+#include "SoundPlayer.hpp"
+#include "World.hpp"
+#include "Snapshot.hpp"
+#include "NetworkProtocol.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+// Include C++ standard headers.
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/**
+ * This class runs the authoritative World headlessly and sends a snapshot of it to every connected client after each
+ * tick. Each snapshot is a delta against the latest one the client acknowledged(or in full while there is none
+ * recent enough), so the bandwidth follows what changes rather than what exists. A snapshot larger than one datagram
+ * is split into several.
+ */
+class GameServer : private sf::NonCopyable
+{
+ public:
+  // A struct indicates what the server did so far.
+  struct Statistics
+  {
+    // Ticks simulated.
+    std::size_t				ticks;
+    // Snapshots sent, how many of them in full, and their total size in bytes.
+    std::size_t				snapshots;
+    std::size_t				fullSnapshots;
+    std::uint64_t			bytesSent;
+    // Snapshots which were split into several datagrams.
+    std::size_t				fragmented;
+    // Snapshots dropped because they did not fit into MaxFragments datagrams.
+    std::size_t				oversized;
+  };
+
+ public:
+  // Constructor which binds the socket, throws if the port is not available(0 picks any free port).
+  explicit					GameServer(unsigned short port);
+  // Handle the datagrams of the clients, simulate one tick and send the snapshots.
+  void						tick();
+  // Tick at the game's rate until the process is stopped, writing the statistics every second.
+  void						run(std::ostream& out);
+  // Get the port the server listens on.
+  unsigned short			getPort() const;
+  // Get the number of connected clients.
+  std::size_t				getClientCount() const;
+  // Get what the server did so far.
+  const Statistics&			getStatistics() const;
+
+ private:
+  // A struct indicates a connected client.
+  struct Client
+  {
+    sf::IpAddress			address;
+    unsigned short			port;
+    // Tick of the latest snapshot the client acknowledged, Snapshot::NoTick if none.
+    std::uint32_t			acknowledgedTick;
+    // Time the client was last heard from, and when it connected.
+    sf::Time				lastHeard;
+    sf::Time				connected;
+    // A bool value indicates whether a snapshot was ever sent to the client.
+    bool					isServed;
+  };
+
+ private:
+  // Handle every datagram waiting on the socket.
+  void						receive();
+  // Send the snapshot of the current tick to every client.
+  void						sendSnapshots();
+  // Send the encoded body in as many datagrams as it needs to one client, returns whether all of them were sent.
+  bool						sendFragments(const Client& client, std::uint32_t baselineTick);
+  // Get the baseline a client has for the current tick, nullptr if it has none recent enough.
+  const Snapshot*			findBaseline(const Client& client) const;
+  // Get a connected client by its address, nullptr if unknown.
+  Client*					findClient(const sf::IpAddress& address, unsigned short port);
+
+ private:
+  // The sound buffers and a player without output, the server plays nothing.
+  SoundHolder				mSoundBuffers;
+  SoundPlayer				mSoundPlayer;
+  // The authoritative game world.
+  World						mWorld;
+  // Socket receiving from and sending to every client.
+  sf::UdpSocket				mSocket;
+  // The connected clients.
+  std::vector<Client>		mClients;
+  // The snapshots of the last HistorySize ticks, by tick modulo HistorySize.
+  std::array<Snapshot, Network::HistorySize>	mHistory;
+  // Number of ticks simulated.
+  std::uint32_t				mTick;
+  // Clock the client timeouts are measured with.
+  sf::Clock					mClock;
+  // Packet reused for every datagram, and the encoded body of the current snapshot.
+  sf::Packet				mPacket;
+  sf::Packet				mBody;
+  // What the server did so far.
+  Statistics				mStatistics;
+};
+
+#endif // GAMESERVER_HPP
@@ -5,6 +5,11 @@
 #include "State.hpp"
 #include "World.hpp"
 #include "Player.hpp"
+#include "SaveGame.hpp"
+#include "SaveGameWriter.hpp"
+#ifdef LOG_CHECKSUMS
+#include "ChecksumLog.hpp"
+#endif
 
 // Include our Third-Party SFML header
 #include <SFML/Graphics/Sprite.hpp>
@@ -24,12 +29,31 @@ class GameState : public State
   bool		update(sf::Time dt) override;
   // Handle each event in the game command queue.
   bool		handleEvent(const sf::Event& event) override;
+  // Start a new round when the cached game state is pushed again.
+  void		reset() override;
+  // Hand the game world's textures over before the game state is destroyed.
+  void		releaseTextures(std::vector<std::unique_ptr<sf::Texture>>& textures) override;
+
+ private:
+  // Save the game into the quicksave file in the background.
+  void		quicksave();
+  // Replace the game by the quicksave file.
+  void		quickload();
 
  private:
   // A World object indicates the game world.
   World				mWorld;
   // A Player object reference indicates the game player(aircraft).
   Player&			mPlayer;
+  // A std::size_t indicates how many ticks the game world has been updated(used by the allocation budget).
+  std::size_t		mTickCount;
+  // The buffer the game is saved into(it holds the previous save once handed to the writer) and the writer.
+  SaveGame			mQuicksave;
+  SaveGameWriter	mSaveWriter;
+#ifdef LOG_CHECKSUMS
+  // The log receiving the world checksum of every tick.
+  ChecksumLog		mChecksumLog;
+#endif
 };
 
 #endif // GAMESTATE_HPP
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef GLYPHCACHE_HPP
+#define GLYPHCACHE_HPP
+
+// Include project header files
+#include "ResourceIdentifiers.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/Config.hpp>
+
+// Include C++ standard headers.
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+
+// Forward declaration of sf::Text class.
+namespace sf
+{
+  class Text;
+}
+
+/**
+ * This class removes the hitch of a text being drawn for the first time. sf::Font rasterizes glyphs lazily, the
+ * first frame which shows a new character(or a new character size) renders it and may grow the glyph page texture.
+ * Each state declares the characters and sizes it shows, and warmUp() rasterizes all of them at load time.
+ * Texts checked at runtime count every glyph which was not warmed up as a miss.
+ */
+class GlyphCache : private sf::NonCopyable
+{
+ public:
+  // Constructor.
+  GlyphCache();
+  // Declare characters which are shown with a font at a character size.
+  void				declare(Fonts::ID font, unsigned int characterSize, const std::string& characters);
+  // Rasterize every declared glyph into the font's glyph page.
+  void				warmUp(const FontHolder& fonts);
+  // Count the glyphs of a text which were not rasterized before as misses.
+  void				check(const sf::Text& text);
+  // Get the number of glyph cache misses so far.
+  std::size_t		getMissCount() const;
+
+  // All printable ASCII characters.
+  static const std::string	PrintableCharacters;
+
+ private:
+  // Declared characters of each font and character size.
+  std::map<std::pair<Fonts::ID, unsigned int>, std::string>			mDeclared;
+  // Glyphs known to be rasterized(font, character size, code point).
+  std::set<std::tuple<const sf::Font*, unsigned int, sf::Uint32>>	mRasterized;
+  // Number of glyph cache misses so far.
+  std::size_t														mMissCount;
+};
+
+#endif // GLYPHCACHE_HPP
@@ -0,0 +1,76 @@
+#ifndef INPUTSAMPLER_HPP
+#define INPUTSAMPLER_HPP
+
+// Include project header files
+#include "SpscQueue.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/Window/Keyboard.hpp>
+
+// Include C++ standard headers.
+#include <vector>
+#include <atomic>
+#include <thread>
+
+/**
+ * This struct represents one key transition sampled by the InputSampler.
+ */
+struct InputEvent
+{
+  // Default constructor(for the slots of the queue).
+  InputEvent();
+  // Constructor.
+  InputEvent(sf::Keyboard::Key key, bool pressed, sf::Time timestamp);
+
+  // The key which changed.
+  sf::Keyboard::Key			key;
+  // A bool value indicates whether the key went down(true) or up(false).
+  bool						pressed;
+  // When the transition was sampled, measured by the sampler's clock.
+  sf::Time					timestamp;
+};
+
+/**
+ * This class samples the realtime state of a set of keys on its own thread at a high rate, and hands every
+ * transition over as a timestamped InputEvent through a lock-free queue which the main thread drains at the
+ * start of each tick. Window events still come from sf::Window::pollEvent on the main thread, since most
+ * platforms only deliver them to the thread which created the window.
+ */
+class InputSampler : private sf::NonCopyable
+{
+ public:
+  // Constructor which starts sampling the given keys.
+  explicit					InputSampler(const std::vector<sf::Keyboard::Key>& keys);
+  // Destructor which stops the sampling thread.
+  ~InputSampler();
+  // Pop the oldest sampled transition(main thread only), returns false if there is none.
+  bool						pollInput(InputEvent& input);
+  // Get the current time of the clock used for the timestamps.
+  sf::Time					now() const;
+
+ private:
+  // Main loop of the sampling thread.
+  void						run();
+
+ private:
+  // The time between two samples.
+  static const sf::Time		SampleInterval;
+
+  // The keys we sample.
+  std::vector<sf::Keyboard::Key>	mKeys;
+  // The last sampled state of each key in mKeys(only touched by the sampling thread).
+  std::vector<bool>				mKeyStates;
+  // The clock every timestamp is measured with.
+  sf::Clock						mClock;
+  // Sampled transitions on their way to the main thread.
+  SpscQueue<InputEvent, 256>	mQueue;
+  // A bool value indicates whether the sampling thread keeps running.
+  std::atomic<bool>				mRunning;
+  // The sampling thread(declared last so that it starts after everything else is initialized).
+  std::thread					mThread;
+};
+
+#endif // INPUTSAMPLER_HPP
@@ -0,0 +1,111 @@
+#ifndef LEVELFILE_HPP
+#define LEVELFILE_HPP
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+
+// Include C++ standard headers.
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * This class maps a binary level file into memory read-only, so a level of any size is ready at once and only the
+ * pages actually read are loaded. A level file is a Header, then formationCount Formation records, offsetCount
+ * Offset records and spawnCount Spawn records sorted by distance, all made of 32-bit fields in the machine's byte
+ * order. The world consumes the spawns front to back as the view scrolls. Every record is checked at load, so a broken
+ * level fails when it is opened rather than in the middle of a round. Level files are compiled from a text
+ * description with compile().
+ */
+class LevelFile : private sf::NonCopyable
+{
+ public:
+  // "SSLV" in the first four bytes.
+  static const std::uint32_t	Magic = 0x564C5353;
+  // Version of the layout of a level file.
+  static const std::uint32_t	Version = 1;
+  // Index of a formation which does not exist(e.g. a level without escorts).
+  static const std::uint32_t	NoFormation = 0xFFFFFFFF;
+
+  // The first record of a level file.
+  struct Header
+  {
+    std::uint32_t	magic;
+    std::uint32_t	version;
+    // Path of the image the background is tiled with, zero terminated.
+    char			backgroundTile[64];
+    // Height of the world, the view starts at its bottom.
+    float			worldHeight;
+    // Speed with which the view scrolls upward.
+    float			scrollSpeed;
+    // Aircraft type and formation of the escorts of a single player.
+    std::uint32_t	escortType;
+    std::uint32_t	escortFormation;
+    // Number of records following the header.
+    std::uint32_t	formationCount;
+    std::uint32_t	offsetCount;
+    std::uint32_t	spawnCount;
+    // Number of enemies all spawns place together.
+    std::uint32_t	enemyCount;
+  };
+
+  // A group of aircraft placed together, its offsets are consecutive records.
+  struct Formation
+  {
+    std::uint32_t	firstOffset;
+    std::uint32_t	offsetCount;
+  };
+
+  // Position of one aircraft of a formation relative to the formation's anchor(world orientation, y downward).
+  struct Offset
+  {
+    float			x;
+    float			y;
+  };
+
+  // A formation of enemies which appears once the view has scrolled far enough.
+  struct Spawn
+  {
+    // Distance of the anchor ahead of the player's spawn position, and its horizontal offset from it.
+    float			distance;
+    float			x;
+    // Aircraft type of every enemy of the formation.
+    std::uint32_t	type;
+    std::uint32_t	formation;
+  };
+
+ public:
+  // Constructor which maps a level file, throws if it cannot be opened or is not a level file.
+  explicit				LevelFile(const std::string& filename);
+  // Destructor which unmaps the file.
+  ~LevelFile();
+  // Get the header of the level.
+  const Header&			getHeader() const;
+  // Get the path of the background tile.
+  std::string			getBackgroundTile() const;
+  // Get a formation and its offsets(checked at load).
+  const Formation&		getFormation(std::size_t index) const;
+  const Offset&			getOffset(std::size_t index) const;
+  // Get the number of spawns, and one spawn(checked at load).
+  std::size_t			getSpawnCount() const;
+  const Spawn&			getSpawn(std::size_t index) const;
+  // Compile a text description of a level into a level file.
+  static void			compile(const std::string& source, const std::string& destination);
+
+ private:
+  // Map the whole file read-only.
+  void					map(const std::string& filename);
+  // Unmap the file.
+  void					unmap();
+
+ private:
+  // The mapped bytes of the file and their number.
+  const char*			mData;
+  std::size_t			mSize;
+  // The records following the header.
+  const Formation*		mFormations;
+  const Offset*			mOffsets;
+  const Spawn*			mSpawns;
+};
+
+#endif // LEVELFILE_HPP
@@ -16,12 +16,16 @@ class MenuState : public State
  public:
   // Constructor of MenuState class.
   MenuState(StateStack& stack, Context context);
+  // Declare the glyphs the state shows, so that they are rasterized at load time.
+  static void	declareGlyphs(GlyphCache& glyphs);
   // Draw the menu state's game world.
   void			draw() override;
   // Just return true in menu state.(We do not need any update here)
   bool			update(sf::Time dt) override;
   // Process each menu options.
   bool			handleEvent(const sf::Event& event) override;
+  // Select the first option again and pre-warm the game state.
+  void			reset() override;
   // Present visual effects on all option text under menu state.
   void			updateOptionText();
 
@@ -0,0 +1,24 @@
+#ifndef NETWORKBENCHMARK_HPP
+#define NETWORKBENCHMARK_HPP
+
+// Include C++ standard headers.
+#include <ostream>
+#include <cstddef>
+
+/**
+ * This class runs a GameServer with 1, 10 and 100 simulated clients over loopback and reports the server's ticks per
+ * second and the bandwidth each client receives. Run the game with --benchmark-network to start it instead of the
+ * game.
+ */
+class NetworkBenchmark
+{
+ public:
+  // Measure every client count and write the results.
+  static void		run(std::ostream& out);
+
+ private:
+  // Measure one client count and write the result.
+  static void		measure(std::size_t clientCount, std::ostream& out);
+};
+
+#endif // NETWORKBENCHMARK_HPP
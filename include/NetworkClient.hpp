@@ -0,0 +1,75 @@
+#ifndef NETWORKCLIENT_HPP
+#define NETWORKCLIENT_HPP
+
+// Include project header files
+#include "Snapshot.hpp"
+#include "NetworkProtocol.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+// Include C++ standard headers.
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * This class connects to a GameServer and reads the snapshots it sends. Every snapshot read is acknowledged, so the
+ * server can send the next one as a delta against it; the snapshots of the last HistorySize ticks are kept for that.
+ * A snapshot split into several datagrams is put back together first, only the newest one is being reassembled.
+ */
+class NetworkClient : private sf::NonCopyable
+{
+ public:
+  // Constructor which binds any free port and asks the server to connect.
+  NetworkClient(const sf::IpAddress& server, unsigned short port);
+  // Destructor which tells the server that the client leaves.
+  ~NetworkClient();
+  // Read every datagram waiting on the socket, returns whether a newer snapshot arrived.
+  bool					receive();
+  // Get the latest snapshot, nullptr until the first one arrived.
+  const Snapshot*		getSnapshot() const;
+  // Get the number of bytes received so far.
+  std::uint64_t			getBytesReceived() const;
+
+ private:
+  // Send a message without payload to the server.
+  void					send(Network::Message message);
+  // Add one fragment of a split snapshot, returns whether the snapshot is complete(its body is in mBody then).
+  bool					addFragment(std::uint32_t tick, std::uint32_t baselineTick, std::size_t index,
+                                    std::size_t count);
+  // Decode and acknowledge a snapshot body, returns whether it was read.
+  bool					readSnapshot(sf::Packet& body, std::uint32_t tick, std::uint32_t baselineTick);
+
+ private:
+  // Address and port of the server.
+  sf::IpAddress			mServer;
+  unsigned short		mServerPort;
+  // Socket receiving from and sending to the server.
+  sf::UdpSocket			mSocket;
+  // The snapshots of the last HistorySize ticks, by tick modulo HistorySize.
+  std::array<Snapshot, Network::HistorySize>	mHistory;
+  // Tick of the latest snapshot, Snapshot::NoTick if none.
+  std::uint32_t			mLatestTick;
+  // Time since the connection was last requested(it is requested again until a snapshot arrives).
+  sf::Clock				mConnectClock;
+  // Packet reused for every datagram, and the body of a reassembled snapshot.
+  sf::Packet			mPacket;
+  sf::Packet			mBody;
+  // The snapshot being reassembled: its ticks, its number of fragments, which ones arrived and their bytes.
+  std::uint32_t			mFragmentTick;
+  std::uint32_t			mFragmentBaselineTick;
+  std::size_t			mFragmentCount;
+  std::size_t			mFragmentsReceived;
+  std::vector<bool>		mHasFragment;
+  std::vector<char>		mFragmentData;
+  std::size_t			mFragmentDataSize;
+  // Number of bytes received so far.
+  std::uint64_t			mBytesReceived;
+};
+
+#endif // NETWORKCLIENT_HPP
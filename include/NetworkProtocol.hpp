@@ -0,0 +1,56 @@
+#ifndef NETWORKPROTOCOL_HPP
+#define NETWORKPROTOCOL_HPP
+
+// Include our Third-Party SFML header
+#include <SFML/Config.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+// Include C++ standard headers.
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * This namespace holds what the server and its clients agree on. Every datagram starts with a Network::Message.
+ *
+ * Client to server: Connect, Acknowledge(sf::Uint32 tick of the last snapshot read) and Disconnect.
+ * Server to client: WorldState(sf::Uint32 tick, sf::Uint32 baseline tick or Snapshot::NoTick, sf::Uint8 fragment
+ * index, sf::Uint8 fragment count, then the fragment's part of the body written by Snapshot::write()). A body is
+ * split into parts of FragmentSize bytes(the last one shorter), the client puts them back together.
+ *
+ * Peer to peer(RollbackSession): PeerInput(sf::Uint32 number of the receiver's inputs the sender has, sf::Uint32
+ * tick of the first input, sf::Uint8 count, then one sf::Uint8 action mask per tick) and PeerChecksum(sf::Uint32
+ * tick, then the high and the low sf::Uint32 of the world checksum at the start of that tick).
+ */
+namespace Network
+{
+  // Use enum to represent the type of a datagram.
+  enum Message
+  {
+    Connect,
+    Acknowledge,
+    Disconnect,
+    WorldState,
+    PeerInput,
+    PeerChecksum,
+  };
+
+  // Port the server listens on unless another one is given.
+  const unsigned short	DefaultPort = 53000;
+  // Number of past snapshots both sides keep, a baseline must not be older.
+  const std::size_t		HistorySize = 32;
+  // The server simulates and sends at the same rate as the game.
+  const sf::Time		TimePerTick = sf::seconds(1.f / 60.f);
+  // Size of the view of the server's world, the same as the game window so that clients see what it simulates.
+  const sf::Vector2f	ViewSize(640.f, 480.f);
+  // A client which has not been heard from for this long is dropped.
+  const sf::Time		ClientTimeout = sf::seconds(5.f);
+  // Size of the header of a WorldState datagram, and of the part of the body each one carries(the last one less).
+  // Both together stay below sf::UdpSocket::MaxDatagramSize.
+  const std::size_t		WorldStateHeaderSize = 11;
+  const std::size_t		FragmentSize = 65000;
+  // A snapshot is split into this many datagrams at most.
+  const std::size_t		MaxFragments = 255;
+}
+
+#endif // NETWORKPROTOCOL_HPP
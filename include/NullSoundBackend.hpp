@@ -0,0 +1,41 @@
+#ifndef NULLSOUNDBACKEND_HPP
+#define NULLSOUNDBACKEND_HPP
+
+// Include project header files
+#include "SoundBackend.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+
+// Include C++ standard headers.
+#include <vector>
+
+/**
+ * This class outputs nothing, for machines without an audio device. Voices still stay busy for the duration of
+ * the buffer they play, so voice allocation, priorities and culling behave exactly as with real output.
+ */
+class NullSoundBackend : public SoundBackend
+{
+ public:
+  // Constructor.
+  explicit			NullSoundBackend(std::size_t voiceCount);
+  // Get the number of voices.
+  std::size_t		getVoiceCount() const override;
+  // Pretend to play a sound buffer on a voice.
+  void				play(std::size_t voice, const sf::SoundBuffer& buffer, sf::Vector2f position) override;
+  // Stop a voice.
+  void				stop(std::size_t voice) override;
+  // Check whether a voice is still playing.
+  bool				isPlaying(std::size_t voice) const override;
+  // Ignore the listener position.
+  void				setListenerPosition(sf::Vector2f position) override;
+
+ private:
+  // The clock the end times are measured with.
+  sf::Clock				mClock;
+  // When each voice finishes playing.
+  std::vector<sf::Time>	mEndTimes;
+};
+
+#endif // NULLSOUNDBACKEND_HPP
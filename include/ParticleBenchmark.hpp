@@ -0,0 +1,24 @@
+#ifndef PARTICLEBENCHMARK_HPP
+#define PARTICLEBENCHMARK_HPP
+
+// Include C++ standard headers.
+#include <ostream>
+#include <cstddef>
+
+/**
+ * This class measures the update of one ParticleSystem(integrating, expiring and writing the quads) with 32k, 64k
+ * and 128k live particles, the largest being the pool size of the game world. Run the game with
+ * --benchmark-particles to start it instead of the game.
+ */
+class ParticleBenchmark
+{
+ public:
+  // Measure every particle count and write the results.
+  static void		run(std::ostream& out);
+
+ private:
+  // Measure one particle count and write the result.
+  static void		measure(std::size_t particleCount, std::ostream& out);
+};
+
+#endif // PARTICLEBENCHMARK_HPP
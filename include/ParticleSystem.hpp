@@ -0,0 +1,82 @@
+#ifndef PARTICLESYSTEM_HPP
+#define PARTICLESYSTEM_HPP
+
+// Include project header files
+#include "SceneNode.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Graphics/Vertex.hpp>
+
+// Include C++ standard headers.
+#include <vector>
+#include <cstddef>
+
+/**
+ * This class holds every particle of one type in one scene node instead of one node per particle.
+ * Particles live in a fixed-capacity pool stored as separate arrays per field(structure of arrays). The update
+ * integrates each array in its own branch-free loop so that the compiler can vectorize it, then removes the expired
+ * particles and writes the quads, which are drawn with one draw call. Removing a particle moves the last one into
+ * its slot, so the pool stays dense. Positions are world coordinates, the node itself must not be transformed.
+ */
+class ParticleSystem : public SceneNode
+{
+ public:
+  // Use enum to represent the type of particles a system holds, each type has its own look and lifetime.
+  enum Type
+  {
+    Exhaust,
+    Explosion,
+    TypeCount,
+  };
+
+ public:
+  // Constructor which allocates the whole pool.
+  ParticleSystem(Type type, std::size_t capacity);
+  // Add one particle, returns false if the pool is full.
+  bool				spawn(sf::Vector2f position, sf::Vector2f velocity);
+  // Remove every particle.
+  void				clear();
+  // Switch spawning on or off, spawn() ignores every particle while it is off.
+  void				setEmitting(bool isEmitting);
+  // Integrate the particles only every interval-th update(with the time of the skipped ones), 1 by default.
+  void				setUpdateInterval(std::size_t interval);
+  // Get the type of particles held.
+  Type				getType() const;
+  // Get the number of live particles.
+  std::size_t		getCount() const;
+  // Get the maximum number of live particles.
+  std::size_t		getCapacity() const;
+
+ private:
+  // Integrate, expire and write the quads of all particles.
+  void				updateCurrent(sf::Time dt) override;
+  // Draw all particles with one draw call.
+  void				drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+  // Move the last particle into a slot.
+  void				remove(std::size_t index);
+  // Write the quad of one particle.
+  void				writeQuad(std::size_t index);
+
+ private:
+  // Type of particles held.
+  Type						mType;
+  // Position, velocity and age(in seconds) of each particle.
+  std::vector<float>		mPositionsX;
+  std::vector<float>		mPositionsY;
+  std::vector<float>		mVelocitiesX;
+  std::vector<float>		mVelocitiesY;
+  std::vector<float>		mAges;
+  // Four vertices per particle, the first 4 * mCount are drawn.
+  std::vector<sf::Vertex>	mVertices;
+  // Number of live particles(the first mCount entries of each array).
+  std::size_t				mCount;
+  // A bool value indicates whether new particles are spawned.
+  bool						mIsEmitting;
+  // The particles are integrated every mUpdateInterval-th update.
+  std::size_t				mUpdateInterval;
+  // Number of updates skipped since the particles were last integrated, and the time they add up to.
+  std::size_t				mSkippedUpdates;
+  sf::Time					mSkippedTime;
+};
+
+#endif // PARTICLESYSTEM_HPP
@@ -7,6 +7,7 @@
 // Include our Third-Party SFML header
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
 
 /**
  * This class represents the pause state which inherits State class.
@@ -16,17 +17,23 @@ class PauseState : public State
  public:
   // Constructor of PauseState class.
   PauseState(StateStack& stack, Context context);
+  // Declare the glyphs the state shows, so that they are rasterized at load time.
+  static void	declareGlyphs(GlyphCache& glyphs);
   //  Draw the screen of PauseState.
   void		draw() override;
   // Always return false so that the game is actually paused.
   bool		update(sf::Time dt) override;
   // Handle each event according to the key user pressed.
   bool		handleEvent(const sf::Event& event) override;
+  // The paused game below does not change, so it can be drawn from a frozen frame.
+  bool		freezesStatesBelow() const override;
 
 
  private:
   // A sf::Sprite object indicates the background sprite of the pause state.
   sf::Sprite		mBackgroundSprite;
+  // A sf::RectangleShape object indicates the transparent background shape(built once instead of every frame).
+  sf::RectangleShape	mBackgroundShape;
   // A sf::Text object indicates the paused text.
   sf::Text			mPausedText;
   // A sf::Text object indicates the instruction text.
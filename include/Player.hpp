@@ -9,9 +9,12 @@
 
 // Include C++ standard headers.
 #include <map>
+#include <array>
+#include <vector>
 
-// Forward declaration of CommandQueue.
+// Forward declaration of CommandQueue and InputEvent.
 class CommandQueue;
+struct InputEvent;
 
 /**
  * This class handles all real time input and events(except quit game event).
@@ -26,6 +29,7 @@ class Player
     MoveRight,
     MoveUp,
     MoveDown,
+    Fire,
     ActionCount
   };
 
@@ -34,8 +38,16 @@ class Player
   Player();
   // Creates a command for each event.
   void					handleEvent(const sf::Event& event, CommandQueue& commands);
-  // Creates a command every frame an arrow key is held down.
+  // Record a key transition sampled by the InputSampler.
+  void					handleSampledInput(const InputEvent& input);
+  // Creates a command every frame an arrow key is held down(according to the sampled input).
   void					handleRealtimeInput(CommandQueue& commands);
+  // Get the realtime actions of this tick as a mask with the bit (1 << action) set for each one.
+  unsigned int			sampleActions();
+  // Forget the keys tapped since the last tick(taps meant for a menu must not move the aircraft).
+  void					clearTaps();
+  // Get the keys bound to realtime actions, which have to be sampled.
+  std::vector<sf::Keyboard::Key>	getRealtimeKeys() const;
   // Set and the key mapped to a specific action.
   void					assignKey(Action action, sf::Keyboard::Key key);
   // Get and the key mapped to a specific action.
@@ -50,6 +62,10 @@ class Player
   std::map<sf::Keyboard::Key, Action>		mKeyBinding;
   // A std::map between Action enum and Command objects.
   std::map<Action, Command>				    mActionBinding;
+  // Whether each key is held down according to the sampled input.
+  std::array<bool, sf::Keyboard::KeyCount>	mKeyDown;
+  // Whether each key went down since the last tick, so that a tap shorter than one tick still counts.
+  std::array<bool, sf::Keyboard::KeyCount>	mKeyTapped;
 };
 
 #endif // PLAYER_HPP
\ No newline at end of file
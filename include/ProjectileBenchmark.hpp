@@ -0,0 +1,20 @@
+#ifndef PROJECTILEBENCHMARK_HPP
+#define PROJECTILEBENCHMARK_HPP
+
+// Include C++ standard headers.
+#include <ostream>
+#include <cstddef>
+
+/**
+ * This class measures whole ticks of a headless World whose view is filled with 10k, 50k and 65k live projectiles,
+ * so the time includes integrating them, collecting them as collision bodies, sorting and sweeping them and
+ * removing the ones used up. Run the game with --benchmark-projectiles to start it instead of the game.
+ */
+class ProjectileBenchmark
+{
+ public:
+  // Measure every projectile count and write the results.
+  static void		run(std::ostream& out);
+};
+
+#endif // PROJECTILEBENCHMARK_HPP
@@ -0,0 +1,108 @@
+#ifndef PROJECTILESYSTEM_HPP
+#define PROJECTILESYSTEM_HPP
+
+// Include project header files
+#include "SceneNode.hpp"
+#include "Scalar.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+// Include C++ standard headers.
+#include <vector>
+#include <cstddef>
+
+// Forward declaration of SaveGame class.
+class SaveGame;
+
+/**
+ * This class holds every projectile of the game in one scene node instead of one node per bullet.
+ * Projectiles live in a fixed-capacity pool stored as separate arrays per field(structure of arrays), so one
+ * linear pass per tick integrates them, removes those which left the bounds and writes their quads, and one draw
+ * call renders all of them. Removing a projectile moves the last one into its slot, so the pool stays dense.
+ * Positions are world coordinates, the node itself must not be transformed.
+ */
+class ProjectileSystem : public SceneNode
+{
+ public:
+  // Use enum to represent who fired a projectile.
+  enum Side
+  {
+    Allied,
+    Enemy,
+  };
+
+ public:
+  // A struct indicates the live projectiles at one point in time, copied as a whole.
+  struct State
+  {
+    std::vector<Scalar>		positionsX;
+    std::vector<Scalar>		positionsY;
+    std::vector<Scalar>		velocitiesX;
+    std::vector<Scalar>		velocitiesY;
+    std::vector<Side>		sides;
+  };
+
+ public:
+  // Constructor which allocates the whole pool.
+  explicit			ProjectileSystem(std::size_t capacity);
+  // Add one projectile, returns false if the pool is full.
+  bool				spawn(Side side, Vector2s position, Vector2s velocity);
+  // Set the area outside of which projectiles are removed.
+  void				setBounds(const sf::FloatRect& bounds);
+  // Remove every projectile.
+  void				clear();
+  // Flag one projectile for removal by removeDestroyed().
+  void				destroy(std::size_t index);
+  // Check whether one projectile is flagged for removal.
+  bool				isDestroyed(std::size_t index) const;
+  // Remove every flagged projectile in one pass.
+  void				removeDestroyed();
+  // Copy the live projectiles into a saved state.
+  void				saveState(State& state) const;
+  // Bring the live projectiles back from a saved state.
+  void				restoreState(const State& state);
+  // Write the live projectiles into a saved game, or replace them by the ones of a saved game.
+  void				save(SaveGame& save) const;
+  void				load(SaveGame& save);
+  // Get the number of live projectiles.
+  std::size_t		getCount() const;
+  // Get the maximum number of live projectiles.
+  std::size_t		getCapacity() const;
+
+ private:
+  // Integrate, cull and write the quads of all projectiles in one pass.
+  void				updateCurrent(sf::Time dt) override;
+  // Add every projectile as a collision body.
+  void				collectCurrentBodies(CollisionSystem& collisions) override;
+  // Add the position, velocity and category of every projectile to a checksum.
+  void				hashCurrentState(StateHash& hash) override;
+  // Write the category and position of every projectile into a snapshot.
+  void				writeCurrentSnapshot(Snapshot& snapshot) override;
+  // Draw all projectiles with one draw call.
+  void				drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+  // Move the last projectile into a slot.
+  void				remove(std::size_t index);
+  // Write the quad of one projectile.
+  void				writeQuad(std::size_t index);
+
+ private:
+  // Position and velocity of each projectile.
+  std::vector<Scalar>		mPositionsX;
+  std::vector<Scalar>		mPositionsY;
+  std::vector<Scalar>		mVelocitiesX;
+  std::vector<Scalar>		mVelocitiesY;
+  // Who fired each projectile.
+  std::vector<Side>			mSides;
+  // Whether each projectile is flagged for removal.
+  std::vector<bool>			mDestroyed;
+  // Four vertices per projectile, the first 4 * mCount are drawn.
+  std::vector<sf::Vertex>	mVertices;
+  // Number of live projectiles(the first mCount entries of each array).
+  std::size_t				mCount;
+  // Projectiles outside of this area are removed.
+  sf::FloatRect				mBounds;
+};
+
+#endif // PROJECTILESYSTEM_HPP
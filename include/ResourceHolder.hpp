@@ -3,6 +3,7 @@
 
 // Include C++ standard headers.
 #include <map>
+#include <vector>
 #include <string>
 #include <memory>
 #include <stdexcept>
@@ -27,9 +28,9 @@ class ResourceHolder
   Resource&					get(Identifier id);
   // Get the const reference of a resource object according to its identifier(no members will be changed in the process).
   const Resource&			get(Identifier id) const;
-
- private:
-  // Insert resource's identifier and unique_ptr as key value pair into the resource map.
+  // Move every resource out of the holder(so that they can be destroyed somewhere else).
+  void						releaseAll(std::vector<std::unique_ptr<Resource>>& resources);
+  // Insert resource's identifier and unique_ptr as key value pair into the resource map(e.g. one made in memory).
   void						insertResource(Identifier id, std::unique_ptr<Resource> resource);
 
  private:
@@ -84,6 +84,21 @@ const Resource& ResourceHolder<Resource, Identifier>::get(Identifier id) const
   return *(found -> second);
 }
 
+/**
+ * Move every resource out of the holder, which is empty afterwards.
+ * @tparam Resource Indicates the resource type
+ * @tparam Identifier Indicates the identifier of the resource
+ * @param resources Indicates the vector receiving the unique_ptr of each resource
+ */
+template <typename Resource, typename Identifier>
+void ResourceHolder<Resource, Identifier>::releaseAll(std::vector<std::unique_ptr<Resource>>& resources)
+{
+  for (auto& pair : mResourceMap)
+    resources.push_back(std::move(pair.second));
+
+  mResourceMap.clear();
+}
+
 /**
  * Insert resource's identifier and unique_ptr as key value pair into the resource map.
  * @tparam Resource Indicates the resource type
@@ -6,6 +6,7 @@ namespace sf
 {
   class Texture;
   class Font;
+  class SoundBuffer;
 }
 
 // Create a namespace called Textures to hold all sf::Texture objects we need for the game by enum.
@@ -31,6 +32,19 @@ namespace Fonts
   };
 }
 
+// Create a namespace called SoundEffect to hold all sf::SoundBuffer objects we need for the game by enum.
+namespace SoundEffect
+{
+  // enum name is also ID.
+  enum ID
+  {
+    AlliedGunfire,
+    EnemyGunfire,
+    Explosion,
+    EffectCount,
+  };
+}
+
 // Forward declaration and a few type definitions
 template <typename Resource, typename Identifier>
 class ResourceHolder;
@@ -41,4 +55,7 @@ typedef ResourceHolder<sf::Texture, Textures::ID>   TextureHolder;
 // We use FontHolder to be an alias of ResourceHolder<sf::Font, Fonts::ID> type.
 typedef ResourceHolder<sf::Font, Fonts::ID>			FontHolder;
 
+// We use SoundHolder to be an alias of ResourceHolder<sf::SoundBuffer, SoundEffect::ID> type.
+typedef ResourceHolder<sf::SoundBuffer, SoundEffect::ID>	SoundHolder;
+
 #endif // RESOURCEIDENTIFIERS_HPP
\ No newline at end of file
@@ -0,0 +1,59 @@
+#ifndef ROLLBACKAPPLICATION_HPP
+#define ROLLBACKAPPLICATION_HPP
+
+// Include project header files
+#include "ResourceHolder.hpp"
+#include "ResourceIdentifiers.hpp"
+#include "SoundPlayer.hpp"
+#include "Player.hpp"
+#include "World.hpp"
+#include "RollbackSession.hpp"
+#include "FramePacer.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+// Include C++ standard headers.
+#include <ostream>
+
+/**
+ * This class plays a game of two players against one remote peer with rollback netcode. The local player steers
+ * one aircraft with the keyboard, the RollbackSession steers the other one with the remote input. The statistics of
+ * the session are written every second.
+ */
+class RollbackApplication : private sf::NonCopyable
+{
+ public:
+  // Constructor which opens the window and binds the local port.
+  RollbackApplication(std::size_t localPlayer, unsigned short localPort, unsigned short remotePort,
+                      sf::Time latency);
+  // Play until the window is closed.
+  void						run(std::ostream& out);
+
+ private:
+  // Handle the events of the window and record the keys of the local player.
+  void						processInput();
+  // Draw the world.
+  void						render();
+
+ private:
+  // A window object that can serve as a target for 2D drawing.
+  sf::RenderWindow			mWindow;
+  // No sound buffers, the world plays nothing while being simulated again and again.
+  SoundHolder				mSoundBuffers;
+  SoundPlayer				mSoundPlayer;
+  // The world of both players.
+  World						mWorld;
+  // The local player's key bindings.
+  Player					mPlayer;
+  // The connection to the remote peer.
+  RollbackSession			mSession;
+  // Limits the frame rate.
+  FramePacer				mPacer;
+  // Actions of the local player sampled during stalled frames, they are taken by the next tick.
+  unsigned int				mPendingActions;
+};
+
+#endif // ROLLBACKAPPLICATION_HPP
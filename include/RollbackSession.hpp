@@ -0,0 +1,147 @@
+#ifndef ROLLBACKSESSION_HPP
+#define ROLLBACKSESSION_HPP
+
+// Include project header files
+#include "World.hpp"
+#include "NetworkProtocol.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+// Include C++ standard headers.
+#include <array>
+#include <cstdint>
+#include <queue>
+
+/**
+ * This class runs a World shared by two peers without input delay. Each tick is simulated at once with the local
+ * input and a prediction of the remote one(its last confirmed input repeated). The world state before each tick is
+ * saved; when a remote input arrives which differs from the prediction, the world is restored to the tick of that
+ * input and the ticks since are simulated again within the same frame. The local peer stalls rather than running
+ * more than MaxRollback ticks ahead of the remote input it has. Checksums of confirmed ticks are exchanged to detect
+ * a desync. Outgoing datagrams can be delayed to test with artificial latency over loopback.
+ */
+class RollbackSession : private sf::NonCopyable
+{
+ public:
+  // A struct indicates what the session did so far.
+  struct Statistics
+  {
+    // Ticks simulated for the first time.
+    std::uint64_t			ticks;
+    // Rollbacks done, and ticks simulated again by them.
+    std::uint64_t			rollbacks;
+    std::uint64_t			resimulatedTicks;
+    // Most ticks simulated again during one frame.
+    std::size_t				mostResimulatedTicks;
+    // Frames in which the session waited for remote input.
+    std::uint64_t			stalls;
+    // Confirmed ticks whose checksum differed between the peers.
+    std::uint64_t			desyncs;
+  };
+
+  // Most ticks which are simulated again by one rollback.
+  static const std::size_t	MaxRollback = 8;
+
+ public:
+  // Constructor which binds the local port, throws if it is not available.
+  RollbackSession(World& world, std::size_t localPlayer, unsigned short localPort, const sf::IpAddress& remote,
+                  unsigned short remotePort, sf::Time latency);
+  // Simulate the next tick with the local actions, returns false if it stalled waiting for remote input.
+  bool						advance(unsigned int localActions);
+  // Get the number of ticks simulated.
+  std::uint32_t				getTick() const;
+  // Get what the session did so far.
+  const Statistics&			getStatistics() const;
+
+ private:
+  // Read every datagram waiting on the socket.
+  void						receive();
+  // Store the remote inputs of a datagram and confirm the ones received in order.
+  void						readInputs(sf::Packet& packet);
+  // Save the world, then simulate one tick with the inputs known or predicted for it.
+  void						simulate(std::uint32_t tick);
+  // Restore the world to the earliest mispredicted tick and simulate the ticks since again.
+  void						rollback();
+  // Send the local inputs the remote peer does not have yet.
+  void						sendInputs();
+  // Send the checksums of the ticks which became confirmed.
+  void						sendChecksums();
+  // Compare the local and remote checksums of the same tick.
+  void						compareChecksums();
+  // Send a datagram once the artificial latency has passed.
+  void						send(const sf::Packet& packet);
+  // Send the delayed datagrams which are due.
+  void						flush();
+
+ private:
+  // A struct indicates a datagram waiting for the artificial latency.
+  struct DelayedPacket
+  {
+    sf::Time				due;
+    sf::Packet				packet;
+  };
+
+  // A struct indicates the checksum of the world at the start of a tick.
+  struct Checksum
+  {
+    std::uint32_t			tick;
+    std::uint64_t			value;
+  };
+
+ private:
+  // Number of inputs kept per peer, enough for every input not yet acknowledged.
+  static const std::size_t	InputHistorySize = 32;
+  // Number of saved world states, enough to go back MaxRollback ticks.
+  static const std::size_t	StateCount = MaxRollback + 1;
+
+  // The world simulated.
+  World&					mWorld;
+  // Index of the local player in the world, the remote one is the other.
+  std::size_t				mLocalPlayer;
+  // Address and port of the remote peer.
+  sf::IpAddress				mRemote;
+  unsigned short			mRemotePort;
+  // Socket receiving from and sending to the remote peer.
+  sf::UdpSocket				mSocket;
+  // Delay of every outgoing datagram.
+  sf::Time					mLatency;
+  // Datagrams waiting for the artificial latency, oldest first.
+  std::queue<DelayedPacket>	mDelayed;
+  // Clock measuring when delayed datagrams are due.
+  sf::Clock					mClock;
+  // Number of ticks simulated, the next tick to simulate.
+  std::uint32_t				mTick;
+  // Local inputs, and the remote inputs used by the simulation(confirmed or predicted), by tick modulo history.
+  std::array<unsigned int, InputHistorySize>	mLocalInputs;
+  std::array<unsigned int, InputHistorySize>	mUsedRemoteInputs;
+  // Remote inputs received and the tick of each one, by tick modulo history.
+  std::array<unsigned int, InputHistorySize>	mRemoteInputs;
+  std::array<std::uint32_t, InputHistorySize>	mRemoteInputTicks;
+  // Number of remote inputs confirmed, they were all received in order.
+  std::uint32_t				mConfirmedRemoteTicks;
+  // Number of local inputs the remote peer confirmed(according to its last datagram).
+  std::uint32_t				mAcknowledgedLocalTicks;
+  // Remote input predicted for the ticks not confirmed yet(the last confirmed one).
+  unsigned int				mPredictedInput;
+  // Earliest tick whose remote input was mispredicted, NoTick if none.
+  std::uint32_t				mRollbackTick;
+  // The world state at the start of the last StateCount ticks, with their ticks and checksums.
+  std::array<World::State, StateCount>		mStates;
+  std::array<std::uint32_t, StateCount>		mStateTicks;
+  std::array<std::uint64_t, StateCount>		mStateChecksums;
+  // The next tick whose checksum is sent, and the last local and remote checksums not compared yet.
+  std::uint32_t				mNextChecksumTick;
+  Checksum					mLocalChecksum;
+  Checksum					mRemoteChecksum;
+  // Packet reused for every datagram.
+  sf::Packet				mPacket;
+  // What the session did so far.
+  Statistics				mStatistics;
+};
+
+#endif // ROLLBACKSESSION_HPP
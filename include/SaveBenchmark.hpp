@@ -0,0 +1,19 @@
+#ifndef SAVEBENCHMARK_HPP
+#define SAVEBENCHMARK_HPP
+
+// Include C++ standard headers.
+#include <ostream>
+
+/**
+ * This class measures how long saving a running World into a SaveGame and loading it back takes, without the
+ * file(which a SaveGameWriter writes in the background). Run the game with --benchmark-save to start it instead of
+ * the game.
+ */
+class SaveBenchmark
+{
+ public:
+  // Measure saving and loading and write the results.
+  static void		run(std::ostream& out);
+};
+
+#endif // SAVEBENCHMARK_HPP
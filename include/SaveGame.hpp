@@ -0,0 +1,67 @@
+#ifndef SAVEGAME_HPP
+#define SAVEGAME_HPP
+
+// Include C++ standard headers.
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * This class holds a saved game as one buffer of raw values: a header(magic number, version and the format of the
+ * simulation's numbers), then whatever the World writes, in the order it reads it back. Values are trivially
+ * copyable and copied bytewise in the machine's byte order, so writing thousands of entities is a few memcpy calls.
+ * A save only loads into a build with the same Version and number format; bump Version whenever what the World
+ * writes changes. Reading past the end or a header which does not match throws std::runtime_error.
+ */
+class SaveGame
+{
+ public:
+  // "SSQS" in the first four bytes, a save written in another byte order does not match it.
+  static const std::uint32_t	Magic = 0x53515353;
+  // Version of the layout of a save.
+  static const std::uint32_t	Version = 2;
+
+ public:
+  // Constructor of an empty save.
+  SaveGame();
+  // Drop everything and write the header of a new save(the room of the buffer is kept).
+  void					clear();
+  // Reserve room, so that writing up to that many bytes never reallocates.
+  void					reserve(std::size_t size);
+  // Append a value or an array of values.
+  template <typename T>
+  void					write(const T& value);
+  template <typename T>
+  void					writeArray(const T* values, std::size_t count);
+  // Check the header and start reading from the first value after it.
+  void					rewind();
+  // Read the next value or array of values.
+  template <typename T>
+  T						read();
+  template <typename T>
+  void					readArray(T* values, std::size_t count);
+  // Write the whole save into a file, or replace it by the content of a file.
+  void					saveToFile(const std::string& filename) const;
+  void					loadFromFile(const std::string& filename);
+  // Exchange the buffers of two saves.
+  void					swap(SaveGame& other);
+  // Get the size of the save in bytes.
+  std::size_t			getSize() const;
+
+ private:
+  // Append or read raw bytes.
+  void					writeBytes(const void* data, std::size_t size);
+  void					readBytes(void* data, std::size_t size);
+  // Get the format of the simulation's numbers in this build.
+  static std::uint32_t	getScalarFormat();
+
+ private:
+  // The bytes of the save.
+  std::vector<char>		mData;
+  // Offset of the next value read.
+  std::size_t			mReadPosition;
+};
+
+#include "SaveGame.inl"
+#endif // SAVEGAME_HPP
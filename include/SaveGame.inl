@@ -0,0 +1,50 @@
+// Include C++ standard headers.
+#include <type_traits>
+
+/**
+ * Append a value to the save.
+ * @param value a trivially copyable value.
+ */
+template <typename T>
+void SaveGame::write(const T& value)
+{
+  static_assert(std::is_trivially_copyable<T>::value, "SaveGame::write - T must be trivially copyable");
+  writeBytes(&value, sizeof(T));
+}
+
+/**
+ * Append an array of values to the save with one copy.
+ * @param values a pointer to the first trivially copyable value.
+ * @param count a std::size_t indicates the number of values.
+ */
+template <typename T>
+void SaveGame::writeArray(const T* values, std::size_t count)
+{
+  static_assert(std::is_trivially_copyable<T>::value, "SaveGame::writeArray - T must be trivially copyable");
+  writeBytes(values, count * sizeof(T));
+}
+
+/**
+ * Read the next value of the save.
+ * @return the value.
+ */
+template <typename T>
+T SaveGame::read()
+{
+  static_assert(std::is_trivially_copyable<T>::value, "SaveGame::read - T must be trivially copyable");
+  T value;
+  readBytes(&value, sizeof(T));
+  return value;
+}
+
+/**
+ * Read the next array of values of the save with one copy.
+ * @param values a pointer to room for the values.
+ * @param count a std::size_t indicates the number of values.
+ */
+template <typename T>
+void SaveGame::readArray(T* values, std::size_t count)
+{
+  static_assert(std::is_trivially_copyable<T>::value, "SaveGame::readArray - T must be trivially copyable");
+  readBytes(values, count * sizeof(T));
+}
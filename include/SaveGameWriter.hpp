@@ -0,0 +1,53 @@
+#ifndef SAVEGAMEWRITER_HPP
+#define SAVEGAMEWRITER_HPP
+
+// Include project header files
+#include "SaveGame.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+
+// Include C++ standard headers.
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * This class writes saved games into files on a background thread, so that saving never stalls the frame on the
+ * disk. A save is handed over by swapping buffers, the caller gets the buffer of the previous save back to reuse.
+ * A file is written under a temporary name first and then renamed, so a crash never leaves half a save behind.
+ */
+class SaveGameWriter : private sf::NonCopyable
+{
+ public:
+  // Constructor which starts the background thread.
+  SaveGameWriter();
+  // Destructor which finishes the pending write and stops the background thread.
+  ~SaveGameWriter();
+  // Hand a save over to be written into a file, returns false(keeping the save) while the last one is written.
+  bool						write(SaveGame& save, const std::string& filename);
+  // Check whether a save is still being written.
+  bool						isWriting();
+
+ private:
+  // Main loop of the background thread.
+  void						run();
+
+ private:
+  // The save being written and the path of its file.
+  SaveGame					mSave;
+  std::string				mFilename;
+  // A bool value indicates whether mSave waits to be written or is being written.
+  bool						mIsWriting;
+  // Protects mSave, mFilename, mIsWriting and mRunning.
+  std::mutex				mMutex;
+  // Wakes the background thread up when there is work or when it must stop.
+  std::condition_variable	mCondition;
+  // A bool value indicates whether the background thread keeps running.
+  bool						mRunning;
+  // The background thread(declared last so that it starts after everything else is initialized).
+  std::thread				mThread;
+};
+
+#endif // SAVEGAMEWRITER_HPP
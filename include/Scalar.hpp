@@ -0,0 +1,37 @@
+#ifndef SCALAR_HPP
+#define SCALAR_HPP
+
+// Include project header files
+#include "Fixed.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+/**
+ * Scalar is the number type of the simulation state(positions, velocities, timers of game objects). It is float by
+ * default; with FIXED_POINT_SIMULATION it is Fixed, so that a run gives bit-identical results on every build,
+ * which replays and lockstep networking rely on. Rendering, sound and particles stay float, values cross over
+ * with toScalar() and toFloat() only at those boundaries. Constants are converted with toScalar(), which gives
+ * the same Scalar for the same float everywhere.
+ */
+#ifdef FIXED_POINT_SIMULATION
+typedef Fixed				Scalar;
+#else
+typedef float				Scalar;
+#endif
+
+// A 2D vector of the simulation.
+typedef sf::Vector2<Scalar>	Vector2s;
+
+// Convert a float, double, time or vector into the simulation's number type.
+Scalar		toScalar(float value);
+Scalar		toScalar(double value);
+Scalar		toScalar(sf::Time time);
+Vector2s	toScalar(sf::Vector2f vector);
+// Convert a number or vector of the simulation into float.
+float			toFloat(Scalar value);
+sf::Vector2f	toFloat(Vector2s vector);
+
+#include "Scalar.inl"
+#endif // SCALAR_HPP
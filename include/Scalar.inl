@@ -0,0 +1,85 @@
+#ifdef FIXED_POINT_SIMULATION
+
+/**
+ * Convert a float into the simulation's number type.
+ * @param value a float indicates the value.
+ * @return a Scalar indicates the nearest fixed-point value.
+ */
+inline Scalar toScalar(float value)
+{
+  return Fixed::fromFloat(value);
+}
+
+/**
+ * Convert a double into the simulation's number type.
+ * @param value a double indicates the value.
+ * @return a Scalar indicates the nearest fixed-point value.
+ */
+inline Scalar toScalar(double value)
+{
+  return Fixed::fromDouble(value);
+}
+
+/**
+ * Convert a time into seconds in the simulation's number type, from its integer microseconds.
+ * @param time a sf::Time object indicates the time.
+ * @return a Scalar indicates the seconds.
+ */
+inline Scalar toScalar(sf::Time time)
+{
+  return Fixed::fromRaw(time.asMicroseconds() * Fixed::One / 1000000);
+}
+
+/**
+ * Convert a number of the simulation into float.
+ * @param value a Scalar indicates the value.
+ * @return a float indicates the nearest float value.
+ */
+inline float toFloat(Scalar value)
+{
+  return value.toFloat();
+}
+
+#else
+
+inline Scalar toScalar(float value)
+{
+  return value;
+}
+
+inline Scalar toScalar(double value)
+{
+  return static_cast<float>(value);
+}
+
+inline Scalar toScalar(sf::Time time)
+{
+  return time.asSeconds();
+}
+
+inline float toFloat(Scalar value)
+{
+  return value;
+}
+
+#endif // FIXED_POINT_SIMULATION
+
+/**
+ * Convert a vector into the simulation's number type.
+ * @param vector a sf::Vector2f indicates the vector.
+ * @return a Vector2s indicates the converted vector.
+ */
+inline Vector2s toScalar(sf::Vector2f vector)
+{
+  return Vector2s(toScalar(vector.x), toScalar(vector.y));
+}
+
+/**
+ * Convert a vector of the simulation into float.
+ * @param vector a Vector2s indicates the vector.
+ * @return a sf::Vector2f indicates the converted vector.
+ */
+inline sf::Vector2f toFloat(Vector2s vector)
+{
+  return sf::Vector2f(toFloat(vector.x), toFloat(vector.y));
+}
@@ -13,6 +13,11 @@
 #include <vector>
 #include <memory>
 
+// Forward declaration of CollisionSystem, StateHash and Snapshot class.
+class CollisionSystem;
+class StateHash;
+class Snapshot;
+
 /**
  *  This virtual class represents a scene manipulation object
  *  which inherits sf::Transformable, sf::Drawable and sf::NonCopyable class.
@@ -29,6 +34,8 @@ class SceneNode : public sf::Transformable, public sf::Drawable, public sf::NonC
 
   // Attach one more child SceneNode object to the current SceneNode object.
   void					attachChild(Ptr child);
+  // Reserve room for children, so that attaching up to that many never reallocates.
+  void					reserveChildren(std::size_t count);
   // Try to get and remove one specific child SceneNode object from the current SceneNode object.
   Ptr					detachChild(const SceneNode& node);
   // Update current SceneNode and all its children objects.
@@ -41,12 +48,30 @@ class SceneNode : public sf::Transformable, public sf::Drawable, public sf::NonC
   void					onCommand(const Command& command, sf::Time dt);
   // Virtual method to returns the category of the game object(Category::Scene by default).
   virtual unsigned int	getCategory() const;
+  // Flag current SceneNode for removal, it is removed together with its children by the next removeWrecks().
+  void					destroy();
+  // Check whether current SceneNode is flagged for removal.
+  bool					isMarkedForRemoval() const;
+  // Move every flagged node of the subtree out of the graph, one sweep per node.
+  void					removeWrecks(std::vector<Ptr>& wrecks);
+  // Add the collision bodies of current SceneNode and all its children objects.
+  void					collectBodies(CollisionSystem& collisions);
+  // Add the simulation state of current SceneNode and all its children objects to a checksum.
+  void					hashState(StateHash& hash);
+  // Write the visible state of current SceneNode and all its children objects into a snapshot.
+  void					writeSnapshot(Snapshot& snapshot);
 
  private:
   // Virtual method to update the current SceneNode object.
   virtual void			updateCurrent(sf::Time dt);
   // Update all current node's children nodes.
   void					updateChildren(sf::Time dt);
+  // Virtual method that only adds the collision bodies of the current object(none by default).
+  virtual void			collectCurrentBodies(CollisionSystem& collisions);
+  // Virtual method that only adds the simulation state of the current object to a checksum(none by default).
+  virtual void			hashCurrentState(StateHash& hash);
+  // Virtual method that only writes the visible state of the current object into a snapshot(none by default).
+  virtual void			writeCurrentSnapshot(Snapshot& snapshot);
   // Override from sf::Drawable to draw the object to a render target.
   virtual void			draw(sf::RenderTarget& target, sf::RenderStates states) const;
   // Virtual method that only draws the current object (but not the children).
@@ -60,6 +85,8 @@ class SceneNode : public sf::Transformable, public sf::Drawable, public sf::NonC
   std::vector<Ptr>		mChildren;
   // A pointer to a SceneNode object which represents parent node.
   SceneNode*			mParent;
+  // A bool value indicates whether the node is flagged for removal.
+  bool					mIsMarkedForRemoval;
 };
 
 #endif // SCENENODE_HPP
@@ -0,0 +1,37 @@
+#ifndef SFMLSOUNDBACKEND_HPP
+#define SFMLSOUNDBACKEND_HPP
+
+// Include project header files
+#include "SoundBackend.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Audio/Sound.hpp>
+
+// Include C++ standard headers.
+#include <vector>
+
+/**
+ * This class plays the voices through sfml-audio, one sf::Sound per voice which is created once and reused.
+ */
+class SfmlSoundBackend : public SoundBackend
+{
+ public:
+  // Constructor.
+  explicit			SfmlSoundBackend(std::size_t voiceCount);
+  // Get the number of voices.
+  std::size_t		getVoiceCount() const override;
+  // Start playing a sound buffer on a voice at a world position.
+  void				play(std::size_t voice, const sf::SoundBuffer& buffer, sf::Vector2f position) override;
+  // Stop a voice.
+  void				stop(std::size_t voice) override;
+  // Check whether a voice is still playing.
+  bool				isPlaying(std::size_t voice) const override;
+  // Move the listener to a world position.
+  void				setListenerPosition(sf::Vector2f position) override;
+
+ private:
+  // One sf::Sound per voice.
+  std::vector<sf::Sound>	mVoices;
+};
+
+#endif // SFMLSOUNDBACKEND_HPP
@@ -0,0 +1,77 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+// Include our Third-Party SFML header
+#include <SFML/System/Vector2.hpp>
+
+// Include C++ standard headers.
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Forward declaration
+namespace sf
+{
+  class Packet;
+}
+
+/**
+ * This class holds what a client needs to draw one tick of the world: the view center, then the category and
+ * position of every visible game object in scene graph order. Positions are quantized to 1/Precision pixels.
+ * A snapshot is written as a delta against a baseline the client already has: every value is sent as a variable
+ * length difference to the object at the same index of the baseline, so an unchanged object costs three bytes and
+ * a projectile moving a few pixels per tick costs four or five.
+ */
+class Snapshot
+{
+ public:
+  // Positions are quantized to steps of 1/Precision pixels.
+  static const int		Precision = 8;
+  // Tick of a snapshot which holds nothing yet.
+  static const std::uint32_t	NoTick = 0xFFFFFFFF;
+
+ public:
+  // Constructor of an empty snapshot.
+  Snapshot();
+  // Set the tick of the snapshot.
+  void					setTick(std::uint32_t tick);
+  // Get the tick of the snapshot(NoTick if it holds nothing).
+  std::uint32_t			getTick() const;
+  // Remove every object and set the view center.
+  void					clear(sf::Vector2f viewCenter);
+  // Reserve room for objects, so that adding up to that many never reallocates.
+  void					reserve(std::size_t count);
+  // Add one object.
+  void					addObject(unsigned int category, sf::Vector2f position);
+  // Get the view center.
+  sf::Vector2f			getViewCenter() const;
+  // Get the number of objects.
+  std::size_t			getObjectCount() const;
+  // Get the category and position of one object.
+  unsigned int			getCategory(std::size_t index) const;
+  sf::Vector2f			getPosition(std::size_t index) const;
+  // Write the view and the objects as a delta against a baseline(nullptr writes them in full).
+  void					write(sf::Packet& packet, const Snapshot* baseline) const;
+  // Read the view and the objects written against the same baseline, returns false if the packet is malformed.
+  bool					read(sf::Packet& packet, const Snapshot* baseline);
+
+ private:
+  // A struct indicates one quantized object.
+  struct Object
+  {
+    std::uint32_t		category;
+    std::int32_t		x;
+    std::int32_t		y;
+  };
+
+ private:
+  // Tick of the world the snapshot was taken at.
+  std::uint32_t			mTick;
+  // Quantized view center.
+  std::int32_t			mViewX;
+  std::int32_t			mViewY;
+  // Every visible object.
+  std::vector<Object>	mObjects;
+};
+
+#endif // SNAPSHOT_HPP
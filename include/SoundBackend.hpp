@@ -0,0 +1,43 @@
+#ifndef SOUNDBACKEND_HPP
+#define SOUNDBACKEND_HPP
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Vector2.hpp>
+
+// Include C++ standard headers.
+#include <memory>
+#include <cstddef>
+
+// Forward declaration of sf::SoundBuffer class.
+namespace sf
+{
+  class SoundBuffer;
+}
+
+/**
+ * This virtual class represents the output of the SoundPlayer, a fixed number of voices which each play one sound
+ * buffer at a time. Positions are world coordinates.
+ */
+class SoundBackend : private sf::NonCopyable
+{
+ public:
+  // Using Ptr as an alias of std::unique_ptr<SoundBackend>.
+  typedef std::unique_ptr<SoundBackend> Ptr;
+
+ public:
+  // Virtual destructor.
+  virtual				~SoundBackend();
+  // Get the number of voices.
+  virtual std::size_t	getVoiceCount() const = 0;
+  // Start playing a sound buffer on a voice at a world position.
+  virtual void			play(std::size_t voice, const sf::SoundBuffer& buffer, sf::Vector2f position) = 0;
+  // Stop a voice.
+  virtual void			stop(std::size_t voice) = 0;
+  // Check whether a voice is still playing.
+  virtual bool			isPlaying(std::size_t voice) const = 0;
+  // Move the listener to a world position.
+  virtual void			setListenerPosition(sf::Vector2f position) = 0;
+};
+
+#endif // SOUNDBACKEND_HPP
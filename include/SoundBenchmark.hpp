@@ -0,0 +1,20 @@
+#ifndef SOUNDBENCHMARK_HPP
+#define SOUNDBENCHMARK_HPP
+
+// Include C++ standard headers.
+#include <ostream>
+
+/**
+ * This class floods a SoundPlayer on the NullSoundBackend(the output of a NULL_AUDIO build) with the gunfire and
+ * explosions of a busy battle, spread around the listener and beyond its hearing distance, so that voices are
+ * stolen by priority and distant sounds are culled. It reports how the requests were handled and what a request
+ * costs the gameplay thread. Run the game with --benchmark-sound to start it instead of the game.
+ */
+class SoundBenchmark
+{
+ public:
+  // Run the battle and write the results.
+  static void		run(std::ostream& out);
+};
+
+#endif // SOUNDBENCHMARK_HPP
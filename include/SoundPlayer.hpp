@@ -0,0 +1,126 @@
+#ifndef SOUNDPLAYER_HPP
+#define SOUNDPLAYER_HPP
+
+// Include project header files
+#include "ResourceIdentifiers.hpp"
+#include "SoundBackend.hpp"
+#include "SpscQueue.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+// Include C++ standard headers.
+#include <vector>
+#include <atomic>
+#include <thread>
+
+/**
+ * This struct represents one request handed from gameplay code to the SoundPlayer.
+ */
+struct SoundRequest
+{
+  // Use enum to represent what the request asks for.
+  enum Type
+  {
+    Play,
+    MoveListener,
+  };
+
+  // Default constructor(for the slots of the queue).
+  SoundRequest();
+  // Constructor.
+  SoundRequest(Type type, SoundEffect::ID effect, sf::Vector2f position, int priority);
+
+  // What the request asks for.
+  Type						type;
+  // The sound effect to play(Play only).
+  SoundEffect::ID			effect;
+  // World position of the sound or of the listener.
+  sf::Vector2f				position;
+  // Higher priority sounds take voices away from lower priority ones(Play only).
+  int						priority;
+};
+
+/**
+ * This class plays sound effects on a fixed pool of voices, so that firing and explosions at bullet-hell rates
+ * never construct a sf::Sound per event. Gameplay code only pushes requests into a lock-free queue. A thread of
+ * the player drains it every few milliseconds, drops the sounds too far from the listener, and hands voices
+ * out by priority. A request gets a free voice if there is one, otherwise it takes the voice of the lowest
+ * priority sound below its own, otherwise it is dropped.
+ * All sound buffers must be loaded into the SoundHolder before the player is constructed.
+ */
+class SoundPlayer : private sf::NonCopyable
+{
+ public:
+  // A struct indicates how the requests were handled so far.
+  struct Counters
+  {
+    // Sounds which started playing.
+    std::size_t				played;
+    // Sounds dropped because they were too far from the listener.
+    std::size_t				culled;
+    // Sounds which took the voice of a lower priority sound.
+    std::size_t				stolen;
+    // Sounds dropped because no voice was available(or the queue was full).
+    std::size_t				dropped;
+  };
+
+ public:
+  // Constructor which starts the player thread.
+  SoundPlayer(const SoundHolder& sounds, SoundBackend::Ptr backend, float hearingDistance = DefaultHearingDistance);
+  // Destructor which stops the player thread.
+  ~SoundPlayer();
+  // Request a sound effect at a world position(one producer thread only).
+  bool						play(SoundEffect::ID effect, sf::Vector2f position, int priority = 0);
+  // Move the listener to a world position(same producer thread as play()).
+  void						setListenerPosition(sf::Vector2f position);
+  // Get how the requests were handled so far.
+  Counters					getCounters() const;
+  // Get the priority a sound effect is played with.
+  static int				getPriority(SoundEffect::ID effect);
+
+  // Sounds farther than this from the listener are not played at all by default.
+  static const float		DefaultHearingDistance;
+
+ private:
+  // Main loop of the player thread.
+  void						run();
+  // Drain the request queue and start the sounds in priority order.
+  void						processRequests();
+  // Start one sound on a free voice or on the voice of a lower priority sound.
+  void						startSound(const SoundRequest& request);
+
+ private:
+  // Maximum number of requests in flight, also the size of one batch.
+  static const std::size_t	QueueCapacity = 256;
+  // How often the player thread drains the queue.
+  static const sf::Time		UpdateInterval;
+
+  // Loaded sound buffers(read-only once the player runs).
+  const SoundHolder&		mSounds;
+  // The output the voices play on.
+  SoundBackend::Ptr			mBackend;
+  // Sounds farther than this from the listener are not played.
+  float						mHearingDistance;
+  // Priority of the sound each voice plays, only touched by the player thread.
+  std::vector<int>			mVoicePriorities;
+  // Requests of the current batch, only touched by the player thread.
+  std::vector<SoundRequest>	mBatch;
+  // Last listener position, only touched by the player thread.
+  sf::Vector2f				mListenerPosition;
+  // Requests from the gameplay thread to the player thread.
+  SpscQueue<SoundRequest, QueueCapacity>	mQueue;
+  // Counters of handled requests.
+  std::atomic<std::size_t>	mPlayed;
+  std::atomic<std::size_t>	mCulled;
+  std::atomic<std::size_t>	mStolen;
+  std::atomic<std::size_t>	mDropped;
+  // A bool value indicates whether the player thread keeps running.
+  std::atomic<bool>			mRunning;
+  // The player thread(declared last so that it starts after everything else is initialized).
+  std::thread				mThread;
+};
+
+#endif // SOUNDPLAYER_HPP
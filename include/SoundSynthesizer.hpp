@@ -0,0 +1,32 @@
+#ifndef SOUNDSYNTHESIZER_HPP
+#define SOUNDSYNTHESIZER_HPP
+
+// Include project header files
+#include "ResourceIdentifiers.hpp"
+
+// Include C++ standard headers.
+#include <memory>
+
+// Forward declaration of sf::SoundBuffer class.
+namespace sf
+{
+  class SoundBuffer;
+}
+
+/**
+ * This class synthesizes the buffers of the sound effects in memory instead of loading them from files: each effect
+ * is a tone sweeping from one frequency to another mixed with noise under a decaying envelope. The noise comes from
+ * a seeded generator, so every run sounds the same.
+ */
+class SoundSynthesizer
+{
+ public:
+  // Synthesize the buffer of every sound effect into a holder, returns the holder(so a member initializer can use it).
+  static SoundHolder&		synthesizeAll(SoundHolder& sounds);
+
+ private:
+  // Synthesize the buffer of one sound effect.
+  static std::unique_ptr<sf::SoundBuffer>	synthesize(SoundEffect::ID effect);
+};
+
+#endif // SOUNDSYNTHESIZER_HPP
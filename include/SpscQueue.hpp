@@ -0,0 +1,41 @@
+#ifndef SPSCQUEUE_HPP
+#define SPSCQUEUE_HPP
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+
+// Include C++ standard headers.
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * Template for a lock-free single-producer single-consumer queue with a fixed capacity.
+ * Exactly one thread may push and exactly one(other) thread may pop, neither of them ever blocks or allocates.
+ * @tparam T Indicates the type of the elements
+ * @tparam Capacity Indicates the maximum number of elements, must be a power of two
+ */
+template <typename T, std::size_t Capacity>
+class SpscQueue : private sf::NonCopyable
+{
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+ public:
+  // Constructor.
+  SpscQueue();
+  // Push one element(producer thread only), returns false if the queue is full.
+  bool						push(const T& value);
+  // Pop one element(consumer thread only), returns false if the queue is empty.
+  bool						pop(T& value);
+
+ private:
+  // Ring buffer holding the elements.
+  std::array<T, Capacity>	mBuffer;
+  // Index of the next element to pop, only written by the consumer(on its own cache line).
+  alignas(64) std::atomic<std::size_t>	mHead;
+  // Index of the next element to push, only written by the producer(on its own cache line).
+  alignas(64) std::atomic<std::size_t>	mTail;
+};
+
+#include "SpscQueue.inl"
+#endif // SPSCQUEUE_HPP
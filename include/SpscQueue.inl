@@ -0,0 +1,55 @@
+
+/**
+ * Constructor of the SpscQueue class, the queue starts empty.
+ * @tparam T Indicates the type of the elements
+ * @tparam Capacity Indicates the maximum number of elements
+ */
+template <typename T, std::size_t Capacity>
+SpscQueue<T, Capacity>::SpscQueue()
+    : mBuffer()
+    , mHead(0)
+    , mTail(0)
+{
+}
+
+/**
+ * Push one element, must only be called from the producer thread.
+ * @tparam T Indicates the type of the elements
+ * @tparam Capacity Indicates the maximum number of elements
+ * @param value Indicates the element to copy into the queue
+ * @return A bool value indicates whether the element was pushed(false if the queue is full)
+ */
+template <typename T, std::size_t Capacity>
+bool SpscQueue<T, Capacity>::push(const T& value)
+{
+  std::size_t tail = mTail.load(std::memory_order_relaxed);
+  // Acquire pairs with the consumer's release, so the slot we overwrite has been read already.
+  if (tail - mHead.load(std::memory_order_acquire) == Capacity)
+    return false;
+
+  mBuffer[tail & (Capacity - 1)] = value;
+  // Release publishes the element before the new tail becomes visible to the consumer.
+  mTail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+/**
+ * Pop one element, must only be called from the consumer thread.
+ * @tparam T Indicates the type of the elements
+ * @tparam Capacity Indicates the maximum number of elements
+ * @param value Indicates where the popped element is copied to
+ * @return A bool value indicates whether an element was popped(false if the queue is empty)
+ */
+template <typename T, std::size_t Capacity>
+bool SpscQueue<T, Capacity>::pop(T& value)
+{
+  std::size_t head = mHead.load(std::memory_order_relaxed);
+  // Acquire pairs with the producer's release, so the element is fully written.
+  if (head == mTail.load(std::memory_order_acquire))
+    return false;
+
+  value = mBuffer[head & (Capacity - 1)];
+  // Release hands the slot back to the producer only after we copied the element out.
+  mHead.store(head + 1, std::memory_order_release);
+  return true;
+}
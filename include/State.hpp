@@ -11,6 +11,7 @@
 
 // Include C++ standard headers.
 #include <memory>
+#include <vector>
 
 // Forward declaration of sf::RenderWindow class.
 namespace sf
@@ -18,9 +19,12 @@ namespace sf
   class RenderWindow;
 }
 
-// Forward declaration of StateStack and Player class.
+// Forward declaration of StateStack, Player and GlyphCache class.
 class StateStack;
 class Player;
+class GlyphCache;
+class SoundPlayer;
+class FrameGovernor;
 
 /**
  * This virtual class represents all behaviour of a general game state.
@@ -34,12 +38,16 @@ class State
   // A struct indicates a holder of shared objects between all states of the game.
   struct Context
   {
-    Context(sf::RenderWindow& window, TextureHolder& textures, FontHolder& fonts, Player& player);
+    Context(sf::RenderWindow& window, TextureHolder& textures, FontHolder& fonts, Player& player,
+            GlyphCache& glyphs, SoundPlayer& sounds, const FrameGovernor& governor);
 
     sf::RenderWindow*	window;
     TextureHolder*		textures;
     FontHolder*			fonts;
     Player*				player;
+    GlyphCache*			glyphs;
+    SoundPlayer*		sounds;
+    const FrameGovernor*	governor;
   };
 
  public:
@@ -53,6 +61,16 @@ class State
   virtual bool		update(sf::Time dt) = 0;
   // Virtual handleEvent method.
   virtual bool		handleEvent(const sf::Event& event) = 0;
+  // Virtual reset method, called when a cached state is pushed again(does nothing by default).
+  virtual void		reset();
+  // Virtual method that hands the state's own textures over before it is destroyed(owns none by default).
+  virtual void		releaseTextures(std::vector<std::unique_ptr<sf::Texture>>& textures);
+  // Check whether the states below this one stay frozen while it is on top(false by default).
+  virtual bool		freezesStatesBelow() const;
+  // Check whether the state's output changed since it was last drawn.
+  bool				isDirty() const;
+  // Remember that the state's current output has been drawn.
+  void				markClean();
 
  protected:
   // Push current state to the game state stack.
@@ -61,8 +79,12 @@ class State
   void				requestStackPop();
   // Clear the game state stack.
   void				requestStateClear();
+  // Construct a game state in the background which is likely to be pushed next.
+  void				requestStatePrewarm(States::ID stateID);
   // Get current state object's Context member.
   Context			getContext() const;
+  // Tell the state stack that the state's output changed and has to be drawn again.
+  void				markDirty();
 
 
  private:
@@ -70,6 +92,8 @@ class State
   StateStack*			mStack;
   // A struct indicates a holder of shared objects between all states of the game.
   Context				mContext;
+  // A bool value indicates whether the state's output changed since it was last drawn.
+  bool					mDirty;
 };
 
 #endif // STATE_HPP
\ No newline at end of file
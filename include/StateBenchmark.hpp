@@ -0,0 +1,21 @@
+#ifndef STATEBENCHMARK_HPP
+#define STATEBENCHMARK_HPP
+
+// Include C++ standard headers.
+#include <ostream>
+
+/**
+ * This class drives the factory StateStack(with and without cached states) and the StaticStateStack through the
+ * same push/update/handleEvent/draw/pop sequence with trivial states, and reports the time and the heap allocations
+ * per stack call. It also removes whole game states in place and through the StateReclaimer(a game state evicted
+ * from the cache) and reports what the removing frame costs. Run the game with --benchmark-states to start it
+ * instead of the game.
+ */
+class StateBenchmark
+{
+ public:
+  // Measure every stack and write the results.
+  static void		run(std::ostream& out);
+};
+
+#endif // STATEBENCHMARK_HPP
@@ -0,0 +1,39 @@
+#ifndef STATEHASH_HPP
+#define STATEHASH_HPP
+
+// Include project header files
+#include "Scalar.hpp"
+
+// Include C++ standard headers.
+#include <cstdint>
+
+/**
+ * This class folds simulation state into a 64-bit checksum(FNV-1a over 64-bit words). Numbers are hashed by their
+ * bits, so two states only give the same checksum if they are bit-identical, which is what a desync or a changed
+ * update path would break. Values must be added in the same order for the checksums to be comparable.
+ */
+class StateHash
+{
+ public:
+  // Constructor, starts from the FNV offset basis.
+  StateHash();
+  // Add an integer(a count, an index or a category).
+  void				addInteger(std::uint64_t value);
+  // Add a number or a vector of the simulation by its bits.
+  void				addScalar(Scalar value);
+  void				addVector(Vector2s vector);
+  // Get the checksum of everything added so far.
+  std::uint64_t		getValue() const;
+
+ private:
+  // Parameters of 64-bit FNV-1a.
+  static const std::uint64_t	FnvOffsetBasis = 14695981039346656037ull;
+  static const std::uint64_t	FnvPrime = 1099511628211ull;
+
+ private:
+  // The checksum so far.
+  std::uint64_t		mValue;
+};
+
+#include "StateHash.inl"
+#endif // STATEHASH_HPP
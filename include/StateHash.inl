@@ -0,0 +1,53 @@
+// Include C++ standard headers.
+#include <cstring>
+
+/**
+ * Constructor of StateHash class, the checksum starts from the FNV offset basis.
+ */
+inline StateHash::StateHash()
+    : mValue(FnvOffsetBasis)
+{
+}
+
+/**
+ * Add an integer to the checksum.
+ * @param value a 64-bit integer indicates the value.
+ */
+inline void StateHash::addInteger(std::uint64_t value)
+{
+  mValue = (mValue ^ value) * FnvPrime;
+}
+
+/**
+ * Add a number of the simulation to the checksum by its bits.
+ * @param value a Scalar indicates the value.
+ */
+inline void StateHash::addScalar(Scalar value)
+{
+#ifdef FIXED_POINT_SIMULATION
+  addInteger(static_cast<std::uint64_t>(value.getRaw()));
+#else
+  std::uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  addInteger(bits);
+#endif
+}
+
+/**
+ * Add a vector of the simulation to the checksum.
+ * @param vector a Vector2s indicates the vector.
+ */
+inline void StateHash::addVector(Vector2s vector)
+{
+  addScalar(vector.x);
+  addScalar(vector.y);
+}
+
+/**
+ * Get the checksum of everything added so far.
+ * @return a 64-bit integer indicates the checksum.
+ */
+inline std::uint64_t StateHash::getValue() const
+{
+  return mValue;
+}
@@ -0,0 +1,54 @@
+#ifndef STATERECLAIMER_HPP
+#define STATERECLAIMER_HPP
+
+// Include project header files
+#include "State.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+
+// Include C++ standard headers.
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * This class tears down removed game states without stalling the frame that removes them.
+ * A reclaimed state first hands its textures back on the main thread, then the rest of it(scene graph, texts,
+ * containers) is destroyed on a background thread. The textures are released later on the main thread, since
+ * that is where the OpenGL context which owns them lives.
+ */
+class StateReclaimer : private sf::NonCopyable
+{
+ public:
+  // Constructor which starts the background thread.
+  StateReclaimer();
+  // Destructor which destroys everything left and stops the background thread.
+  ~StateReclaimer();
+  // Hand a removed state over to be destroyed in the background.
+  void											reclaim(State::Ptr state);
+  // Release the textures of reclaimed states(main thread, once per frame).
+  void											releaseGraphicsResources();
+
+ private:
+  // Main loop of the background thread.
+  void											run();
+
+ private:
+  // Textures handed back by reclaimed states, only touched by the main thread.
+  std::vector<std::unique_ptr<sf::Texture>>		mTextures;
+  // States waiting to be destroyed by the background thread.
+  std::vector<State::Ptr>						mStates;
+  // Protects mStates and mRunning.
+  std::mutex									mMutex;
+  // Wakes the background thread up when there is work or when it must stop.
+  std::condition_variable						mCondition;
+  // A bool value indicates whether the background thread keeps running.
+  bool											mRunning;
+  // The background thread(declared last so that it starts after everything else is initialized).
+  std::thread									mThread;
+};
+
+#endif // STATERECLAIMER_HPP
@@ -3,6 +3,8 @@
 
 // Include project header files
 #include "State.hpp"
+#include "StateReclaimer.hpp"
+#include "FrozenFrame.hpp"
 #include "StateIdentifiers.hpp"
 #include "ResourceIdentifiers.hpp"
 
@@ -12,9 +14,12 @@
 
 // Include C++ standard headers.
 #include <vector>
+#include <array>
 #include <utility>
 #include <functional>
 #include <map>
+#include <set>
+#include <future>
 
 // Forward declaration of sf::Event class and sf::RenderWindow class.
 namespace sf
@@ -23,6 +28,10 @@ namespace sf
   class RenderWindow;
 }
 
+// Forward declaration of StaticStateStack class.
+template <std::size_t MaxDepth, typename... Bindings>
+class StaticStateStack;
+
 /**
  * This class represents all behaviour of the stack of game states which inherits sf::NonCopyable.
  */
@@ -48,6 +57,8 @@ class StateStack : private sf::NonCopyable
   void				update(sf::Time dt);
   // Draw each state one by one from the mStack.
   void				draw();
+  // Check whether the stack or any state on it changed since the last draw.
+  bool				isDirty() const;
   // Handle each event in the mStack one by one.
   void				handleEvent(const sf::Event& event);
   // Add one game state to the mStack.
@@ -58,17 +69,36 @@ class StateStack : private sf::NonCopyable
   void				clearStates();
   // Check if the stack of game states is empty.
   bool				isEmpty() const;
+  // Keep popped states of a specific ID alive so that the next push reuses them instead of constructing again.
+  void				setCached(States::ID stateID, bool cached = true);
+  // Construct a specific game state on a background thread so that a later push of it completes immediately.
+  void				prewarmState(States::ID stateID);
+  // Set the target frame rate while a specific game state is on top of the stack(0 means no limit).
+  void				setFrameRate(States::ID stateID, unsigned int framesPerSecond);
+  // Get the target frame rate of the state on top of the stack.
+  unsigned int		getFrameRate() const;
 
  private:
-  // Takes an ID of a state and returns a smart pointer to the corresponding state class.
+  // Takes an ID of a state and returns a smart pointer to the corresponding state class(cached, pre-warmed or new).
   State::Ptr		createState(States::ID stateID);
+  // Keep a removed state in the cache if its ID is cached, otherwise hand it over to the reclaimer.
+  void				releaseState(States::ID stateID, State::Ptr state);
   // Apply pending changes to the specific game state stack(game state push, pop or clear).
   void				applyPendingChanges();
 
+  // StaticStateStack uses a StateStack to record the changes its states request.
+  template <std::size_t MaxDepth, typename... Bindings>
+  friend class StaticStateStack;
+
  private:
+  // Maximum number of pending changes requested between two applyPendingChanges() calls.
+  static const std::size_t	MaxPendingChanges = 16;
+
   // A struct indicates pending changes needed to be processed on the game state stack.
   struct PendingChange
   {
+    // Default constructor of the PendingChange struct(for unused entries of the pending buffer).
+    PendingChange();
     // Constructor of the PendingChange struct.
     explicit			PendingChange(Action action, States::ID stateID = States::None);
     // An enum indicates an action that one pending change should perform.
@@ -77,17 +107,46 @@ class StateStack : private sf::NonCopyable
     States::ID			stateID;
   };
 
+  // A struct indicates one game state on the stack together with the ID it was created from.
+  struct StackEntry
+  {
+    // Constructor of the StackEntry struct.
+    StackEntry(States::ID stateID, State::Ptr state);
+    // An enum indicates the game state's id.
+    States::ID			stateID;
+    // A unique_ptr to the game state object.
+    State::Ptr			state;
+  };
+
+  // Add one pending change to the fixed-capacity pending buffer, throws std::logic_error if it is full.
+  void				addPendingChange(const PendingChange& change);
 
  private:
-  // A vector hold each unique_ptr to game state objects.
-  std::vector<State::Ptr>								mStack;
-  // Since we cannot add or remove element while loop the game stack we use another vector
+  // A vector hold each game state object(and its ID).
+  std::vector<StackEntry>								mStack;
+  // Since we cannot add or remove element while loop the game stack we use a fixed-capacity buffer
   // to hold all PendingChange objects that indicates pending game state changes.
-  std::vector<PendingChange>							mPendingList;
+  std::array<PendingChange, MaxPendingChanges>		mPendingList;
+  // Number of PendingChange objects used in mPendingList.
+  std::size_t											mPendingCount;
   // A holder of shared objects between all states of the game.
   State::Context										mContext;
+  // A bool value indicates whether states were pushed or removed since the last draw.
+  bool													mDirty;
+  // Frame drawn by the states below the topmost pause-type state.
+  FrozenFrame											mFrozenFrame;
   // Maps States::ID to those factory functions that create a new state on-demand.
   std::map<States::ID, std::function<State::Ptr()>>	    mFactories;
+  // IDs of the states which are kept alive after being removed from the stack.
+  std::set<States::ID>									mCachedIDs;
+  // Target frame rate of each game state ID.
+  std::map<States::ID, unsigned int>					mFrameRates;
+  // Removed states waiting to be reused by the next push of their ID.
+  std::map<States::ID, State::Ptr>						mCache;
+  // States being constructed on a background thread(declared last so pending constructions finish first on exit).
+  std::map<States::ID, std::future<State::Ptr>>		mPrewarmed;
+  // Destroys removed states in the background so that Pop and Clear do not stall the frame.
+  StateReclaimer										mReclaimer;
 };
 
 /**
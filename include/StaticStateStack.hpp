@@ -0,0 +1,130 @@
+#ifndef STATICSTATESTACK_HPP
+#define STATICSTATESTACK_HPP
+
+// Include project header files
+#include "State.hpp"
+#include "StateStack.hpp"
+#include "FrozenFrame.hpp"
+#include "StateIdentifiers.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Time.hpp>
+
+// Include C++ standard headers.
+#include <array>
+#include <map>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * Binds a state ID to the state class which is created for it, at compile time.
+ * @tparam StateID indicates the unique identifier of the state
+ * @tparam T indicates the derived state class
+ */
+template <States::ID StateID, typename T>
+struct StateBinding
+{
+  static const States::ID	id = StateID;
+  typedef T					Type;
+};
+
+/**
+ * This namespace holds the compile-time helpers of StaticStateStack which walk the list of state bindings.
+ */
+namespace StaticStates
+{
+  // Largest size of all bound state classes.
+  template <typename... Bindings>
+  struct MaxSize;
+
+  // Largest alignment of all bound state classes.
+  template <typename... Bindings>
+  struct MaxAlign;
+
+  // Calls the right state class for a type index without going through the virtual table.
+  template <std::size_t Index, typename... Bindings>
+  struct Dispatch;
+}
+
+/**
+ * This class represents a stack of game states whose set of state classes is known at compile time.
+ * Unlike StateStack it has no factory map: states are constructed in-place inside a fixed array of slots,
+ * update/draw/handleEvent are dispatched on a type index without virtual calls, and pending changes are kept
+ * in a fixed-capacity buffer, so pushing and popping states never touches the heap by itself.
+ * States still request changes through the StateStack reference they are constructed with, which is why an
+ * internal StateStack records those requests.
+ * @tparam MaxDepth indicates how many states can be on the stack at the same time
+ * @tparam Bindings indicates the StateBinding of every state which can be pushed
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+class StaticStateStack : private sf::NonCopyable
+{
+ public:
+  // Constructor.
+  explicit			StaticStateStack(State::Context context);
+  // Destructor which destroys all states still on the stack.
+  ~StaticStateStack();
+
+  // Update each game state by delta time.
+  void				update(sf::Time dt);
+  // Draw each state one by one from bottom to top.
+  void				draw();
+  // Check whether the stack or any state on it changed since the last draw.
+  bool				isDirty() const;
+  // Handle each event from top to bottom.
+  void				handleEvent(const sf::Event& event);
+  // Add one game state to the stack.
+  void				pushState(States::ID stateID);
+  // Remove one game state from the stack.
+  void				popState();
+  // Clear the game state stack.
+  void				clearStates();
+  // Check if the stack of game states is empty.
+  bool				isEmpty() const;
+  // Set the target frame rate while a specific game state is on top of the stack(0 means no limit).
+  void				setFrameRate(States::ID stateID, unsigned int framesPerSecond);
+  // Get the target frame rate of the state on top of the stack.
+  unsigned int		getFrameRate() const;
+
+ private:
+  // Apply pending changes recorded by mRequests(game state push, pop or clear).
+  void				applyPendingChanges();
+  // Destroy the state on top of the stack.
+  void				destroyTop();
+
+ private:
+  // A struct indicates one slot of the stack, big enough to hold any of the bound state classes.
+  struct Slot
+  {
+    // Raw storage the state is constructed in.
+    typename std::aligned_storage<StaticStates::MaxSize<Bindings...>::value,
+                                  StaticStates::MaxAlign<Bindings...>::value>::type	storage;
+    // Index of the state's binding inside Bindings.
+    std::size_t			typeIndex;
+    // ID the state was pushed with.
+    States::ID			stateID;
+  };
+
+  // Dispatcher over all bound state classes.
+  typedef StaticStates::Dispatch<0, Bindings...>	Dispatcher;
+
+ private:
+  // A StateStack which records the changes requested by the states(it never holds any state itself).
+  StateStack				mRequests;
+  // A holder of shared objects between all states of the game.
+  State::Context			mContext;
+  // Fixed array of slots, the first mSize of them hold a state.
+  std::array<Slot, MaxDepth>	mSlots;
+  // Number of states on the stack.
+  std::size_t				mSize;
+  // A bool value indicates whether states were pushed or removed since the last draw.
+  bool						mDirty;
+  // Frame drawn by the states below the topmost pause-type state.
+  FrozenFrame				mFrozenFrame;
+  // Target frame rate of each game state ID.
+  std::map<States::ID, unsigned int>	mFrameRates;
+};
+
+#include "StaticStateStack.inl"
+#endif // STATICSTATESTACK_HPP
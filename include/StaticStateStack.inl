@@ -0,0 +1,375 @@
+// Include C++ standard headers.
+#include <cassert>
+#include <new>
+
+namespace StaticStates
+{
+  /**
+   * Largest size of all bound state classes(recursion ends with an empty list).
+   */
+  template <>
+  struct MaxSize<>
+  {
+    static const std::size_t value = 0;
+  };
+
+  template <typename First, typename... Rest>
+  struct MaxSize<First, Rest...>
+  {
+    static const std::size_t value = sizeof(typename First::Type) > MaxSize<Rest...>::value
+                                     ? sizeof(typename First::Type) : MaxSize<Rest...>::value;
+  };
+
+  /**
+   * Largest alignment of all bound state classes(recursion ends with an empty list).
+   */
+  template <>
+  struct MaxAlign<>
+  {
+    static const std::size_t value = 1;
+  };
+
+  template <typename First, typename... Rest>
+  struct MaxAlign<First, Rest...>
+  {
+    static const std::size_t value = alignof(typename First::Type) > MaxAlign<Rest...>::value
+                                     ? alignof(typename First::Type) : MaxAlign<Rest...>::value;
+  };
+
+  /**
+   * End of the binding list: the type index matched no binding.
+   * @tparam Index indicates the number of bindings
+   */
+  template <std::size_t Index>
+  struct Dispatch<Index>
+  {
+    static std::size_t construct(States::ID, void*, StateStack&, State::Context)
+    {
+      return Index;
+    }
+
+    static void destroy(std::size_t, void*)
+    {
+    }
+
+    static bool update(std::size_t, void*, sf::Time)
+    {
+      return false;
+    }
+
+    static void draw(std::size_t, void*)
+    {
+    }
+
+    static bool handleEvent(std::size_t, void*, const sf::Event&)
+    {
+      return false;
+    }
+
+    static State* state(std::size_t, void*)
+    {
+      return nullptr;
+    }
+  };
+
+  /**
+   * Checks whether the type index(or state ID) belongs to the First binding and forwards to the Rest otherwise.
+   * Member calls are qualified with the state class, so the compiler calls them directly instead of through
+   * the virtual table.
+   * @tparam Index indicates the type index of the First binding
+   * @tparam First indicates the binding handled at this level
+   * @tparam Rest indicates the remaining bindings
+   */
+  template <std::size_t Index, typename First, typename... Rest>
+  struct Dispatch<Index, First, Rest...>
+  {
+    typedef typename First::Type	Type;
+    typedef Dispatch<Index + 1, Rest...>	Next;
+
+    static std::size_t construct(States::ID stateID, void* storage, StateStack& stack, State::Context context)
+    {
+      if (stateID != First::id)
+        return Next::construct(stateID, storage, stack, context);
+
+      new (storage) Type(stack, context);
+      return Index;
+    }
+
+    static void destroy(std::size_t typeIndex, void* storage)
+    {
+      if (typeIndex != Index)
+        return Next::destroy(typeIndex, storage);
+
+      static_cast<Type*>(storage) -> Type::~Type();
+    }
+
+    static bool update(std::size_t typeIndex, void* storage, sf::Time dt)
+    {
+      if (typeIndex != Index)
+        return Next::update(typeIndex, storage, dt);
+
+      return static_cast<Type*>(storage) -> Type::update(dt);
+    }
+
+    static void draw(std::size_t typeIndex, void* storage)
+    {
+      if (typeIndex != Index)
+        return Next::draw(typeIndex, storage);
+
+      static_cast<Type*>(storage) -> Type::draw();
+    }
+
+    static bool handleEvent(std::size_t typeIndex, void* storage, const sf::Event& event)
+    {
+      if (typeIndex != Index)
+        return Next::handleEvent(typeIndex, storage, event);
+
+      return static_cast<Type*>(storage) -> Type::handleEvent(event);
+    }
+
+    static State* state(std::size_t typeIndex, void* storage)
+    {
+      if (typeIndex != Index)
+        return Next::state(typeIndex, storage);
+
+      return static_cast<Type*>(storage);
+    }
+  };
+}
+
+/**
+ * Constructor of StaticStateStack class.
+ * @param context indicates a holder of shared objects between all states of the game
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+StaticStateStack<MaxDepth, Bindings...>::StaticStateStack(State::Context context)
+    : mRequests(context)
+    , mContext(context)
+    , mSlots()
+    , mSize(0)
+    , mDirty(true)
+    , mFrozenFrame()
+    , mFrameRates()
+{
+}
+
+/**
+ * Destructor of StaticStateStack class, destroy all states still on the stack from top to bottom.
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+StaticStateStack<MaxDepth, Bindings...>::~StaticStateStack()
+{
+  while (mSize > 0)
+    destroyTop();
+}
+
+/**
+ * Update each game state by delta time, from top to bottom until one returns false.
+ * @param dt a sf::Time object indicates the delta time.
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+void StaticStateStack<MaxDepth, Bindings...>::update(sf::Time dt)
+{
+  for (std::size_t i = mSize; i > 0; --i)
+  {
+    if (!Dispatcher::update(mSlots[i - 1].typeIndex, &mSlots[i - 1].storage, dt))
+      break;
+  }
+  // Apply pending changes to the specific game state stack(game state push, pop or clear).
+  applyPendingChanges();
+}
+
+/**
+ * Draw all active states from bottom to top, the states below the topmost pause-type state are drawn from the
+ * frozen frame once it was captured.
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+void StaticStateStack<MaxDepth, Bindings...>::draw()
+{
+  // Find the topmost state which freezes the states below it.
+  std::size_t firstLive = 0;
+  for (std::size_t i = mSize; i > 0; --i)
+  {
+    if (Dispatcher::state(mSlots[i - 1].typeIndex, &mSlots[i - 1].storage) -> freezesStatesBelow())
+    {
+      firstLive = i - 1;
+      break;
+    }
+  }
+
+  if (firstLive > 0)
+  {
+    if (mFrozenFrame.isValid())
+    {
+      mFrozenFrame.draw(*mContext.window);
+    }
+    else
+    {
+      for (std::size_t i = 0; i < firstLive; ++i)
+        Dispatcher::draw(mSlots[i].typeIndex, &mSlots[i].storage);
+      mFrozenFrame.capture(*mContext.window);
+    }
+  }
+
+  for (std::size_t i = firstLive; i < mSize; ++i)
+    Dispatcher::draw(mSlots[i].typeIndex, &mSlots[i].storage);
+
+  for (std::size_t i = 0; i < mSize; ++i)
+    Dispatcher::state(mSlots[i].typeIndex, &mSlots[i].storage) -> markClean();
+  mDirty = false;
+}
+
+/**
+ * Check whether the stack or any state on it changed since the last draw.
+ * @return a bool value indicates whether the stack has to be drawn again.
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+bool StaticStateStack<MaxDepth, Bindings...>::isDirty() const
+{
+  if (mDirty)
+    return true;
+
+  for (std::size_t i = 0; i < mSize; ++i)
+  {
+    // The slots are only read, the dispatcher just needs a non-const pointer to find the state.
+    void* storage = const_cast<void*>(static_cast<const void*>(&mSlots[i].storage));
+    if (Dispatcher::state(mSlots[i].typeIndex, storage) -> isDirty())
+      return true;
+  }
+  return false;
+}
+
+/**
+ * Handle each event from top to bottom, stop as soon as handleEvent() returns false.
+ * @param event a sf::Event object indicates each event we need to deal with.
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+void StaticStateStack<MaxDepth, Bindings...>::handleEvent(const sf::Event& event)
+{
+  for (std::size_t i = mSize; i > 0; --i)
+  {
+    if (!Dispatcher::handleEvent(mSlots[i - 1].typeIndex, &mSlots[i - 1].storage, event))
+      break;
+  }
+  // Apply pending changes to the specific game state stack(game state push, pop or clear).
+  applyPendingChanges();
+}
+
+/**
+ * Add one game state to the state stack.
+ * @param stateID a enum indicates the ID of the game state.
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+void StaticStateStack<MaxDepth, Bindings...>::pushState(States::ID stateID)
+{
+  mRequests.pushState(stateID);
+}
+
+/**
+ * Remove one game state from the state stack.
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+void StaticStateStack<MaxDepth, Bindings...>::popState()
+{
+  mRequests.popState();
+}
+
+/**
+ * Clear the game state stack.
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+void StaticStateStack<MaxDepth, Bindings...>::clearStates()
+{
+  mRequests.clearStates();
+}
+
+/**
+ * Check if the stack of game states is empty.
+ * @return a bool indicates whether the game state is empty or not.
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+bool StaticStateStack<MaxDepth, Bindings...>::isEmpty() const
+{
+  return mSize == 0;
+}
+
+/**
+ * Set the target frame rate while a specific game state is on top of the stack.
+ * @param stateID a enum indicates the game state id.
+ * @param framesPerSecond an unsigned int indicates the target frame rate, 0 means no limit.
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+void StaticStateStack<MaxDepth, Bindings...>::setFrameRate(States::ID stateID, unsigned int framesPerSecond)
+{
+  mFrameRates[stateID] = framesPerSecond;
+}
+
+/**
+ * Get the target frame rate of the state on top of the stack.
+ * @return an unsigned int indicates the target frame rate, 0 means no limit(also if the stack is empty).
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+unsigned int StaticStateStack<MaxDepth, Bindings...>::getFrameRate() const
+{
+  if (mSize == 0)
+    return 0;
+
+  auto found = mFrameRates.find(mSlots[mSize - 1].stateID);
+  return found != mFrameRates.end() ? found -> second : 0;
+}
+
+/**
+ * Apply the pending changes recorded by mRequests(game state push, pop or clear).
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+void StaticStateStack<MaxDepth, Bindings...>::applyPendingChanges()
+{
+  for (std::size_t i = 0; i < mRequests.mPendingCount; ++i)
+  {
+    const StateStack::PendingChange& change = mRequests.mPendingList[i];
+    // Check the appending change type.
+    switch (change.action)
+    {
+      case StateStack::Push:
+      {
+        // Ensure that there is a free slot.
+        assert(mSize < MaxDepth);
+
+        Slot& slot = mSlots[mSize];
+        slot.typeIndex = Dispatcher::construct(change.stateID, &slot.storage, mRequests, mContext);
+        slot.stateID = change.stateID;
+        // Ensure that the state ID was bound to a state class.
+        assert(slot.typeIndex < sizeof...(Bindings));
+        ++mSize;
+        break;
+      }
+
+      case StateStack::Pop:
+        destroyTop();
+        break;
+
+      case StateStack::Clear:
+        while (mSize > 0)
+          destroyTop();
+        break;
+    }
+  }
+  // Any change of the stack changes what is on screen(and what a frozen frame would show).
+  if (mRequests.mPendingCount > 0)
+  {
+    mDirty = true;
+    mFrozenFrame.invalidate();
+  }
+  // Clear the pending list.
+  mRequests.mPendingCount = 0;
+}
+
+/**
+ * Destroy the state on top of the stack.
+ */
+template <std::size_t MaxDepth, typename... Bindings>
+void StaticStateStack<MaxDepth, Bindings...>::destroyTop()
+{
+  --mSize;
+  Dispatcher::destroy(mSlots[mSize].typeIndex, &mSlots[mSize].storage);
+}
@@ -16,6 +16,8 @@ class TitleState : public State
  public:
   // Constructor of TitleState class.
   TitleState(StateStack& stack, Context context);
+  // Declare the glyphs the state shows, so that they are rasterized at load time.
+  static void	declareGlyphs(GlyphCache& glyphs);
   // Draw the title state's game world.
   void		draw() override;
   // Hide the title state's text and reset the title state's time.
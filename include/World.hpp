@@ -9,14 +9,25 @@
 #include "Aircraft.hpp"
 #include "CommandQueue.hpp"
 #include "Command.hpp"
+#include "SoundPlayer.hpp"
+#include "ProjectileSystem.hpp"
+#include "ParticleSystem.hpp"
+#include "EmitterNode.hpp"
+#include "EntitySystemNode.hpp"
+#include "CollisionSystem.hpp"
+#include "BackgroundStreamer.hpp"
+#include "LevelFile.hpp"
+#include "Scalar.hpp"
 
 // Include our Third-Party SFML header
 #include <SFML/System/NonCopyable.hpp>
 #include <SFML/Graphics/View.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Image.hpp>
 
 // Include C++ standard headers.
 #include <array>
+#include <cstdint>
 #include <queue>
 
 // Forward declaration
@@ -24,6 +35,8 @@ namespace sf
 {
   class RenderWindow;
 }
+class Snapshot;
+class SaveGame;
 
 /**
  * This class represents the world of all game objects(except fonts) which inherits sf::NonCopyable
@@ -32,41 +45,149 @@ namespace sf
 class World : private sf::NonCopyable
 {
  public:
-  // Constructor of World class.
-  explicit							World(sf::RenderWindow& window);
+  // A struct indicates the simulation state of the world at one point in time.
+  struct State
+  {
+    Vector2s						viewCenter;
+    std::size_t						nextSpawn;
+    std::vector<Aircraft::State>	players;
+    EntityRegistry::State			enemies;
+    ProjectileSystem::State			projectiles;
+  };
+
+ public:
+  // Constructor of World class(several players fly side by side without escorts).
+  World(sf::RenderWindow& window, SoundPlayer& sounds, std::size_t playerCount = 1);
+  // Constructor of a headless World class(a server's), which has no window and is never drawn.
+  World(sf::Vector2f viewSize, SoundPlayer& sounds);
   // Controls world scrolling and entity movement per delta time.
   void								update(sf::Time dt);
   // Draw all drawable game objects in the current game world.
   void								draw();
   // Get the current command queue of the game.
   CommandQueue&						getCommandQueue();
+  // Set the actions(a mask of Player::Action bits) one player's aircraft takes during the next update.
+  void								setPlayerActions(std::size_t player, unsigned int actions);
+  // Save and restore the simulation state, which is cheap enough to do every tick.
+  void								saveState(State& state) const;
+  void								restoreState(const State& state);
+  // Switch particle and sound effects on or off, they are off while ticks which were already shown are simulated again.
+  void								setEffectsEnabled(bool isEnabled);
+  // Throttle the cosmetic simulation(exhaust, particle updates and background prefetching) while frames run late.
+  void								setEffectsThrottled(bool isThrottled);
+  // Write the whole game into a saved game(between two updates).
+  void								saveGame(SaveGame& save);
+  // Replace the game by a saved game, throws if it does not fit this world(which is reset then).
+  void								loadGame(SaveGame& save);
+  // Compute a checksum of the simulation state(positions, velocities and categories of every game object).
+  std::uint64_t						computeChecksum();
+  // Write the visible state of every game object into a snapshot.
+  void								writeSnapshot(Snapshot& snapshot);
+  // Rebuild the game world to its initial state while keeping the loaded textures.
+  void								reset();
+  // Hand all loaded textures over(the world must not be drawn afterwards).
+  void								releaseTextures(std::vector<std::unique_ptr<sf::Texture>>& textures);
+
+ private:
+  // A struct indicates an aircraft read from a saved game.
+  struct SavedAircraft
+  {
+    Aircraft::Type		type;
+    Aircraft::State		state;
+  };
+
+  // A struct indicates an enemy entity read from a saved game.
+  struct SavedEnemy
+  {
+    Components::Position	position;
+    Components::Velocity	velocity;
+    Components::Sprite		sprite;
+    Components::Collider	collider;
+    Components::RingWeapon	weapon;
+    Components::Exhaust		exhaust;
+  };
 
  private:
+  // Constructor shared by the windowed and the headless world.
+  World(sf::RenderWindow* window, const sf::View& view, SoundPlayer& sounds, std::size_t playerCount);
   // Load all textures we need for the game world.
   void								loadTextures();
   // Build the whole game world(scene).
   void								buildScene();
+  // Build the layers with the background and the particles.
+  void								buildLayers();
+  // Add the nodes holding every enemy entity and every projectile.
+  void								addSystems();
+  // Steer the player aircraft according to the actions set for them.
+  void								applyPlayerActions();
   // Handle the case where the plane leaves the visible area of the screen.
   void								adaptPlayerPosition();
   // Check and fix diagonal movement situations.
   void								adaptPlayerVelocity();
+  // Attach the escorts of the level to the player's aircraft.
+  void								addEscorts(Aircraft& leader);
+  // Make room for the enemies of the level, which stay dormant until the view approaches them.
+  void								reserveEnemies();
+  // Attach an exhaust emitter behind an aircraft.
+  void								addExhaust(Aircraft& aircraft);
+  // Create the entity of an enemy.
+  void								createEnemy(Aircraft::Type type, Vector2s position);
+  // Create the entities of the spawns the scrolling view has come close to.
+  void								activateEnemies();
+  // Flag the enemies the view has scrolled past for removal.
+  void								removeOffscreenEnemies();
+  // Launch the projectiles of the player and fire the weapons of every enemy entity.
+  void								launchProjectiles(sf::Time dt);
+  // Spawn the exhaust particles of every enemy entity.
+  void								emitExhaust(sf::Time dt);
+  // Find the pairs which collide and flag what they destroy.
+  void								handleCollisions();
+  // Flag the aircraft of a collision body for removal and queue its explosion, unless it is already flagged.
+  void								destroyAircraft(const CollisionSystem::Body& body);
+  // Spawn the sparks and the sound of one explosion.
+  void								explode(sf::Vector2f position);
+  // Remove every flagged entity, node and projectile in one sweep, then spawn the queued explosions.
+  void								removeWrecks();
+  // Replace the game by the content of a saved game, after its header.
+  void								readGame(SaveGame& save);
+  // Write an aircraft into a saved game, or read one.
+  static void						writeAircraft(SaveGame& save, const Aircraft& aircraft);
+  static SavedAircraft				readAircraft(SaveGame& save);
+  // Write the enemy entities into a saved game, or read them.
+  void								writeEnemies(SaveGame& save);
+  void								readEnemies(SaveGame& save, std::vector<SavedEnemy>& enemies) const;
+  // Apply whether effects are enabled and throttled to the particle systems and the background.
+  void								applyEffectSettings();
+  // Get the visible area of the world.
+  sf::FloatRect						getViewBounds() const;
+  // Get the area around the view where game objects are still simulated.
+  sf::FloatRect						getBattlefieldBounds() const;
 
  private:
   // We use enum to represent different layers.
   enum Layer
   {
     Background,
+    LowerAir,
     Air,
     LayerCount
   };
 
  private:
   // Reference to the current sf::RenderWindow object.
-  sf::RenderWindow&					mWindow;
+  sf::RenderWindow*					mWindow;
+  // Reference to the player of all sound effects.
+  SoundPlayer&						mSounds;
   // A sf::View	object indicates current view.
   sf::View							mWorldView;
+  // The center of the view in the simulation, the view follows it.
+  Vector2s							mViewCenter;
+  // The level mapped from its file, its spawns are read as the view scrolls.
+  LevelFile							mLevel;
   // A TextureHolder object to hold all textures we need to build the game world.
   TextureHolder						mTextures;
+  // The tile the background chunks are filled with.
+  sf::Image							mBackgroundTile;
   // A SceneNode object represents a scene.
   SceneNode							mSceneGraph;
   // Fixed-size(LayerCount indicates the size) static array to store pointers of each SceneNode.
@@ -74,14 +195,37 @@ class World : private sf::NonCopyable
   // A CommandQueue object which indicates the current command Queue.
   CommandQueue						mCommandQueue;
 
-  // The bounding rectangle of the game world.
+  // The bounding rectangle of the game world(the background goes on past its top).
   sf::FloatRect						mWorldBounds;
   // The position where the player's plane appears in the beginning.
   sf::Vector2f						mSpawnPosition;
   // The speed with which the world is scrolled.
-  float								mScrollSpeed;
-  // A pointer to the player's aircraft.
-  Aircraft*							mPlayerAircraft;
+  Scalar							mScrollSpeed;
+  // A pointer to the node streaming the background(attached to the background layer, none if headless).
+  BackgroundStreamer*				mBackground;
+  // Pointers to the aircraft of each player.
+  std::vector<Aircraft*>			mPlayerAircraft;
+  // Pointers to the escorts of the first player which are not shot down yet.
+  std::vector<Aircraft*>			mEscorts;
+  // The actions set for each player's aircraft, cleared by each update.
+  std::vector<unsigned int>			mPlayerActions;
+  // Index of the next spawn of the level, the ones before it are entities already.
+  std::size_t						mNextSpawn;
+  // A pointer to the node holding every enemy entity(attached to the air layer).
+  EntitySystemNode*					mEnemies;
+  // Pointers to the node holding the particles of each type(attached to the lower air layer).
+  std::array<ParticleSystem*, ParticleSystem::TypeCount>	mParticleSystems;
+  // A pointer to the node holding every projectile(attached to the air layer).
+  ProjectileSystem*					mProjectiles;
+  // Broadphase of the collision detection.
+  CollisionSystem					mCollisions;
+  // A bool value indicates whether particles are spawned and sounds played, one whether cosmetics are throttled.
+  bool								mEffectsEnabled;
+  bool								mEffectsThrottled;
+  // Nodes removed by the last removeWrecks(), destroyed together.
+  std::vector<SceneNode::Ptr>		mWrecks;
+  // Positions of the aircraft destroyed during the current tick, they explode in removeWrecks().
+  std::vector<sf::Vector2f>			mExplosions;
 };
 
 #endif // WORLD_HPP
\ No newline at end of file
@@ -1,11 +1,25 @@
 // Project header files
 #include "Aircraft.hpp"
 #include "ResourceHolder.hpp"
-#include "Category.hpp"
+#include "ProjectileSystem.hpp"
+#include "CollisionSystem.hpp"
+#include "SoundPlayer.hpp"
 
 // Include our Third-Party SFML header
 #include <SFML/Graphics/RenderTarget.hpp>
 
+// Include C++ standard headers.
+#include <cassert>
+
+namespace
+{
+  // The player fires two parallel projectiles straight ahead at a high rate.
+  const sf::Time PlayerFireInterval = sf::seconds(0.1f);
+  const float PlayerProjectileSpeed = 600.f;
+  const float PlayerProjectileOffset = 10.f;
+}
+
+static_assert(AircraftData::Count == Aircraft::TypeCount, "Every aircraft type needs one entry per table");
 
 /**
  * A isolate method that maps the aircraft type to the corresponding texture ID.
@@ -14,15 +28,8 @@
  */
 Textures::ID toTextureID(Aircraft::Type type)
 {
-  switch (type)
-  {
-    case Aircraft::Eagle:
-      return Textures::Eagle;
-
-    case Aircraft::Raptor:
-      return Textures::Raptor;
-  }
-  return Textures::Eagle;
+  assert(type < Aircraft::TypeCount);
+  return AircraftData::TextureIds[type];
 }
 
 /**
@@ -32,7 +39,10 @@ Textures::ID toTextureID(Aircraft::Type type)
  */
 Aircraft::Aircraft(Type type, const TextureHolder& textures)
     : mType(type)
+    , mCategory(AircraftData::Categories[type])
     , mSprite(textures.get(toTextureID(type)))
+    , mIsFiring(false)
+    , mFireCountdown(sf::Time::Zero)
 {
   // Get the local bounding rectangle of the Aircraft object.
   // The rectangle is of type sf::FloatRect, which stores four float variables called left, top, width, and height.
@@ -41,6 +51,96 @@ Aircraft::Aircraft(Type type, const TextureHolder& textures)
   mSprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
 }
 
+/**
+ * Request to fire during the current tick, the projectiles are launched by launchProjectiles().
+ */
+void Aircraft::fire()
+{
+  mIsFiring = true;
+}
+
+/**
+ * Launch the projectiles requested by fire() once the fire interval has passed, two parallel projectiles ahead.
+ * Enemies are entities whose weapons are fired by the World.
+ * @param dt a sf::Time object indicates the current frame time.
+ * @param projectiles a ProjectileSystem object indicates the pool the projectiles are added to.
+ * @param sounds a pointer to the player of the gunfire, nullptr while effects are off.
+ */
+void Aircraft::launchProjectiles(sf::Time dt, ProjectileSystem& projectiles, SoundPlayer* sounds)
+{
+  if (mFireCountdown > sf::Time::Zero)
+    mFireCountdown -= dt;
+
+  if (!mIsFiring || mFireCountdown > sf::Time::Zero)
+  {
+    mIsFiring = false;
+    return;
+  }
+  mIsFiring = false;
+
+  // The firing aircraft is a direct child of its layer, so its position is a world position.
+  const Vector2s position = getSimulatedPosition();
+  const Vector2s offset(toScalar(PlayerProjectileOffset), toScalar(0.f));
+  const Vector2s velocity = Vector2s(toScalar(0.f), toScalar(-PlayerProjectileSpeed)) + getVelocity();
+  projectiles.spawn(ProjectileSystem::Allied, position - offset, velocity);
+  projectiles.spawn(ProjectileSystem::Allied, position + offset, velocity);
+  mFireCountdown += PlayerFireInterval;
+
+  if (sounds)
+    sounds -> play(SoundEffect::AlliedGunfire, toFloat(position), SoundPlayer::getPriority(SoundEffect::AlliedGunfire));
+}
+
+/**
+ * Get the type of the aircraft.
+ * @return a Type enum indicates the type.
+ */
+Aircraft::Type Aircraft::getType() const
+{
+  return mType;
+}
+
+/**
+ * Override the category the aircraft's type gives it, since a type may fly on either side.
+ * @param category an unsigned int indicates the new category.
+ */
+void Aircraft::setCategory(unsigned int category)
+{
+  mCategory = category;
+}
+
+/**
+ * Get the speed the aircraft flies at when steered.
+ * @return a Scalar indicates the speed.
+ */
+Scalar Aircraft::getMaxSpeed() const
+{
+  return toScalar(AircraftData::Speeds[mType]);
+}
+
+/**
+ * Save the simulation state of the aircraft(its position is relative to its parent).
+ * @param state a State object receiving the state.
+ */
+void Aircraft::saveState(State& state) const
+{
+  state.position = getSimulatedPosition();
+  state.velocity = getVelocity();
+  state.fireCountdown = mFireCountdown;
+  state.isFiring = mIsFiring;
+}
+
+/**
+ * Restore the simulation state of the aircraft.
+ * @param state a State object indicates the saved state.
+ */
+void Aircraft::restoreState(const State& state)
+{
+  setSimulatedPosition(state.position);
+  setVelocity(state.velocity);
+  mFireCountdown = state.fireCountdown;
+  mIsFiring = state.isFiring;
+}
+
 /**
  * Override drawCurrent method from SceneNode class to draw the current Aircraft object.
  * @param target indicates the sf::RenderTarget object we want to draw to
@@ -59,13 +159,14 @@ void Aircraft::drawCurrent(sf::RenderTarget& target, sf::RenderStates states) co
  */
 unsigned int Aircraft::getCategory() const
 {
-  // Check which type the Aircraft is.
-  switch (mType)
-  {
-    case Eagle:
-      return Category::PlayerAircraft;
+  return mCategory;
+}
 
-    default:
-      return Category::EnemyAircraft;
-  }
+/**
+ * Add the world-space bounds of the aircraft as a collision body.
+ * @param collisions a CollisionSystem object indicates where the body is added.
+ */
+void Aircraft::collectCurrentBodies(CollisionSystem& collisions)
+{
+  collisions.addBody(getWorldTransform().transformRect(mSprite.getGlobalBounds()), getCategory(), *this);
 }
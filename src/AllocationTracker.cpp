@@ -0,0 +1,179 @@
+// Include project header files
+#include "AllocationTracker.hpp"
+
+// Include C++ standard headers.
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+  // Allocations made by the current thread so far(plain types so that they are safe to touch inside operator new).
+  thread_local std::size_t	tAllocations = 0;
+  thread_local std::size_t	tBytes = 0;
+  // The zone the current thread is inside.
+  thread_local int			tZone = AllocationTracker::None;
+  // Allocations made by the current thread inside each zone since the last beginFrame() call.
+  thread_local std::size_t	tZoneAllocations[AllocationTracker::ZoneCount] = {};
+  thread_local std::size_t	tZoneBytes[AllocationTracker::ZoneCount] = {};
+
+  // Thread counters at the start of the current frame.
+  AllocationTracker::Counters	frameStart;
+  // Counters of the last completed frame and of each of its zones.
+  AllocationTracker::Counters	lastFrame;
+  AllocationTracker::Counters	lastZones[AllocationTracker::ZoneCount];
+}
+
+/**
+ * Constructor of the Counters struct, all counters start at zero.
+ */
+AllocationTracker::Counters::Counters()
+    : allocations(0)
+    , bytes(0)
+{
+}
+
+/**
+ * Constructor of ScopedZone class, enter the zone on the current thread.
+ * @param zone a Zone enum indicates the zone we enter.
+ */
+AllocationTracker::ScopedZone::ScopedZone(Zone zone)
+    : mPrevious(static_cast<Zone>(tZone))
+{
+  tZone = zone;
+}
+
+/**
+ * Destructor of ScopedZone class, return to the zone which was active before.
+ */
+AllocationTracker::ScopedZone::~ScopedZone()
+{
+  tZone = mPrevious;
+}
+
+/**
+ * Check whether the allocation hooks are compiled in.
+ * @return a bool value indicates whether allocations are counted at all.
+ */
+bool AllocationTracker::isEnabled()
+{
+#ifdef TRACK_ALLOCATIONS
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+ * Record one allocation of the current thread.
+ * @param size a std::size_t indicates how many bytes were requested.
+ */
+void AllocationTracker::recordAllocation(std::size_t size)
+{
+  tAllocations += 1;
+  tBytes += size;
+  tZoneAllocations[tZone] += 1;
+  tZoneBytes[tZone] += size;
+}
+
+/**
+ * Get the counters of all allocations made by the current thread so far.
+ * @return a Counters struct indicates the allocations of the current thread.
+ */
+AllocationTracker::Counters AllocationTracker::getThreadCounters()
+{
+  Counters counters;
+  counters.allocations = tAllocations;
+  counters.bytes = tBytes;
+  return counters;
+}
+
+/**
+ * Close the previous frame and start counting a new one. Must always be called from the same(main) thread.
+ */
+void AllocationTracker::beginFrame()
+{
+  // Store what happened since the previous call.
+  lastFrame.allocations = tAllocations - frameStart.allocations;
+  lastFrame.bytes = tBytes - frameStart.bytes;
+  for (int zone = 0; zone < ZoneCount; ++zone)
+  {
+    lastZones[zone].allocations = tZoneAllocations[zone];
+    lastZones[zone].bytes = tZoneBytes[zone];
+    tZoneAllocations[zone] = 0;
+    tZoneBytes[zone] = 0;
+  }
+
+  // Start the new frame.
+  frameStart = getThreadCounters();
+}
+
+/**
+ * Get the counters of the last completed frame.
+ * @return a Counters struct indicates the allocations of the last frame.
+ */
+AllocationTracker::Counters AllocationTracker::getFrameCounters()
+{
+  return lastFrame;
+}
+
+/**
+ * Get the counters of one zone during the last completed frame.
+ * @param zone a Zone enum indicates the zone we are interested in.
+ * @return a Counters struct indicates the allocations of that zone in the last frame.
+ */
+AllocationTracker::Counters AllocationTracker::getZoneCounters(Zone zone)
+{
+  return lastZones[zone];
+}
+
+#ifdef TRACK_ALLOCATIONS
+
+// Global allocation hooks, every allocation of the program goes through them and is counted.
+
+void* operator new(std::size_t size)
+{
+  AllocationTracker::recordAllocation(size);
+
+  if (void* memory = std::malloc(size == 0 ? 1 : size))
+    return memory;
+
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+  return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  AllocationTracker::recordAllocation(size);
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+  return ::operator new(size, tag);
+}
+
+void operator delete(void* memory) noexcept
+{
+  std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+  std::free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+  std::free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+  std::free(memory);
+}
+
+#endif // TRACK_ALLOCATIONS
@@ -7,9 +7,37 @@
 #include "GameState.hpp"
 #include "MenuState.hpp"
 #include "PauseState.hpp"
+#include "AllocationTracker.hpp"
+#include "SfmlSoundBackend.hpp"
+#include "NullSoundBackend.hpp"
+#include "SoundSynthesizer.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Audio/SoundBuffer.hpp>
+
+// Include C++ standard headers.
+#include <algorithm>
 
 // Initialize time for per frame to be 1/60 which means our game's FPS(frame per second) is 60.
 const sf::Time Application::TimePerFrame = sf::seconds(1.f/60.f);
+// Catch up at most 5 updates(about 83 ms of game time) per frame, anything beyond that is dropped.
+const std::size_t Application::MaxUpdatesPerFrame = 5;
+// Enough voices for gunfire and explosions at once, far below the number of sources OpenAL provides.
+const std::size_t Application::SoundVoiceCount = 32;
+
+/**
+ * Create the output of the sound player, nothing is output if the game is built without audio.
+ * @param voiceCount a std::size_t indicates how many sounds can play at the same time.
+ * @return a unique_ptr to the sound backend.
+ */
+static SoundBackend::Ptr createSoundBackend(std::size_t voiceCount)
+{
+#ifdef NULL_AUDIO
+  return SoundBackend::Ptr(new NullSoundBackend(voiceCount));
+#else
+  return SoundBackend::Ptr(new SfmlSoundBackend(voiceCount));
+#endif
+}
 
 /**
  * Constructor of Application class.
@@ -18,11 +46,26 @@ Application::Application()
     : mWindow(sf::VideoMode(640, 480), "Space Shooter Game", sf::Style::Close)
     , mTextures()
     , mFonts()
+    , mGlyphs()
+    , mSounds()
+    , mSoundPlayer(SoundSynthesizer::synthesizeAll(mSounds), createSoundBackend(SoundVoiceCount))
     , mPlayer()
-    , mStateStack(State::Context(mWindow, mTextures, mFonts, mPlayer))
+    , mInputSampler(mPlayer.getRealtimeKeys())
+    , mStateStack(State::Context(mWindow, mTextures, mFonts, mPlayer, mGlyphs, mSoundPlayer, mGovernor))
+    , mGovernor(TimePerFrame, MaxUpdatesPerFrame)
+    , mPacer()
     , mStatisticsText()
+    , mForceRedraw(true)
     , mStatisticsUpdateTime()
     , mStatisticsNumFrames(0)
+    , mStatisticsUpdateCost()
+    , mStatisticsNumUpdates(0)
+    , mHasUndisplayedInput(false)
+    , mUndisplayedInputTime()
+    , mStatisticsLatency()
+    , mStatisticsMaxLatency()
+    , mStatisticsNumLatencies(0)
+    , mStatisticsCpuTime()
 {
   // If key repeat is enabled, we will receive repeated KeyPressed events while keeping a key pressed.
   mWindow.setKeyRepeatEnabled(false);
@@ -38,6 +81,8 @@ Application::Application()
   mStatisticsText.setCharacterSize(10u);
   // Register all game states.
   registerStates();
+  // Rasterize all glyphs before the first frame.
+  warmUpGlyphs();
   // Push current state(Title state) to the state stack.
   mStateStack.pushState(States::Title);
 }
@@ -49,30 +94,39 @@ void Application::run()
 {
   // Use a Clock object to control and get access to the elapsed time.
   sf::Clock clock;
-  // Initialize the update interval to be zero.
-  sf::Time timeSinceLastUpdate = sf::Time::Zero;
 
-  // Enable or disable vertical synchronization.
-  //Activating vertical synchronization will limit the number of frames displayed to the refresh rate of the monitor.
-  //This can avoid some visual artifacts, and limit the framerate to a good value.
-  mWindow.setVerticalSyncEnabled(true);
+  // Vertical synchronization stays disabled, the FramePacer limits the frame rate instead. With vsync, some drivers
+  // spin inside display() and the frame rate could not be lowered per state.
+  mWindow.setVerticalSyncEnabled(false);
 
   // When the game is still running.
   while (mWindow.isOpen())
   {
+    // Close the allocation counters of the previous frame.
+    AllocationTracker::beginFrame();
     // Get the elapsed time and reset the clock.
     sf::Time dt = clock.restart();
-    // Get the update interval.
-    timeSinceLastUpdate += dt;
+    // Hand the elapsed time to the governor.
+    mGovernor.beginFrame(dt);
     // We divide update interval to a bunch of time for per frame.
-    // We deal with each time per frame.
-    while (timeSinceLastUpdate >= TimePerFrame)
+    // We deal with each time per frame, as many as the governor allows.
+    while (mGovernor.nextStep())
     {
-      timeSinceLastUpdate -= TimePerFrame;
       // Process input.
-      processInput();
-      // Update the game for each frame.
-      update(TimePerFrame);
+      {
+        AllocationTracker::ScopedZone zone(AllocationTracker::Input);
+        processInput();
+      }
+      // Update the game for each frame and measure how long it takes.
+      {
+        AllocationTracker::ScopedZone zone(AllocationTracker::Update);
+        sf::Clock updateClock;
+        update(TimePerFrame);
+        sf::Time updateCost = updateClock.getElapsedTime();
+        mGovernor.endStep(updateCost);
+        mStatisticsUpdateCost += updateCost;
+        mStatisticsNumUpdates += 1;
+      }
 
       // Check inside this loop, because stack might be empty before update() call
       if (mStateStack.isEmpty())
@@ -80,16 +134,36 @@ void Application::run()
     }
     // Update relative graphical texts per real frame according to the elapsed time.
     updateStatistics(dt);
-    // Render the window.
-    render();
+    // Render the window(the governor skips some renders while updates are too expensive).
+    if (mGovernor.shouldRender())
+    {
+      AllocationTracker::ScopedZone zone(AllocationTracker::Render);
+      render();
+    }
+    // Sleep until the next frame is due at the frame rate of the current state.
+    mPacer.setTargetFrameRate(mStateStack.getFrameRate());
+    mPacer.waitForNextFrame();
   }
 }
 
 /**
- * This method handles user input. It polls the application window for any input events.
+ * This method handles user input at the start of each tick. It first hands the key transitions sampled by the
+ * input thread to the player, then polls the application window for any input events.
  */
 void Application::processInput()
 {
+  InputEvent input;
+  while (mInputSampler.pollInput(input))
+  {
+    mPlayer.handleSampledInput(input);
+    // Remember the oldest input which is not on screen yet.
+    if (!mHasUndisplayedInput)
+    {
+      mHasUndisplayedInput = true;
+      mUndisplayedInputTime = input.timestamp;
+    }
+  }
+
   sf::Event event{};
   // Loop if there is still at least one event left.
   while (mWindow.pollEvent(event))
@@ -99,6 +173,9 @@ void Application::processInput()
     // Check if player wants to click the 'x' button and quit the game.
     if (event.type == sf::Event::Closed)
       mWindow.close();
+    // The window content may have been lost or stretched, draw it again.
+    if (event.type == sf::Event::Resized || event.type == sf::Event::GainedFocus)
+      mForceRedraw = true;
   }
 }
 
@@ -112,10 +189,19 @@ void Application::update(sf::Time dt)
 }
 
 /**
- * Render our game(sprites) to the screen.
+ * Render our game(sprites) to the screen. When neither a state nor the statistics changed, the frame on screen is
+ * still up to date, so clearing, drawing and displaying are skipped altogether.
  */
 void Application::render()
 {
+  if (!mForceRedraw && !mStateStack.isDirty())
+  {
+    // Input which changed nothing will never be displayed, so there is no latency to measure.
+    mHasUndisplayedInput = false;
+    return;
+  }
+  mForceRedraw = false;
+
   // Clear the entire 2d window with a default black color.
   mWindow.clear();
   // Draw the whole game world.
@@ -126,6 +212,16 @@ void Application::render()
   mWindow.draw(mStatisticsText);
   // Display the window(then we can see the result).
   mWindow.display();
+
+  // The consumed input is on screen now, measure how long that took since it was sampled.
+  if (mHasUndisplayedInput)
+  {
+    sf::Time latency = mInputSampler.now() - mUndisplayedInputTime;
+    mStatisticsLatency += latency;
+    mStatisticsMaxLatency = std::max(mStatisticsMaxLatency, latency);
+    mStatisticsNumLatencies += 1;
+    mHasUndisplayedInput = false;
+  }
 }
 
 /**
@@ -138,26 +234,97 @@ void Application::updateStatistics(sf::Time dt)
   mStatisticsUpdateTime += dt;
   // Add one frame.
   mStatisticsNumFrames += 1;
+  // Add the CPU time of the previous frame.
+  mStatisticsCpuTime += mPacer.getLastFrameCpuTime();
 
   // We update graphical texts per second.
   if (mStatisticsUpdateTime >= sf::seconds(1.0f))
   {
     // Set frames per second and time per update.
-    mStatisticsText.setString("FPS: " + toString(mStatisticsNumFrames));
+    std::string statistics = "FPS: " + toString(mStatisticsNumFrames);
+    if (mStatisticsNumUpdates > 0)
+      statistics += "\nTime/update: " + toString(mStatisticsUpdateCost.asMicroseconds() / mStatisticsNumUpdates) + "us";
+    // Append the CPU time per frame and the share of one core it adds up to.
+    statistics += "\nCPU: " + toString(mStatisticsCpuTime.asMicroseconds() / 1000.f / mStatisticsNumFrames) + "ms/frame ("
+        + toString(static_cast<int>(100.f * mStatisticsCpuTime.asSeconds() / mStatisticsUpdateTime.asSeconds())) + "% of a core)";
+    // Append the input-to-photon latency.
+    if (mStatisticsNumLatencies > 0)
+      statistics += "\nInput latency: " + toString(mStatisticsLatency.asMicroseconds() / mStatisticsNumLatencies / 1000.f)
+          + "ms avg, " + toString(mStatisticsMaxLatency.asMicroseconds() / 1000.f) + "ms max";
+    // Append how often the governor had to step in so far.
+    const FrameGovernor::Counters& governor = mGovernor.getCounters();
+    if (governor.cappedFrames > 0 || governor.degradedFrames > 0)
+      statistics += "\nGovernor: " + toString(governor.cappedFrames) + " capped, "
+          + toString(governor.droppedTime.asMilliseconds()) + "ms dropped, "
+          + toString(governor.degradedFrames) + " degraded, " + toString(governor.skippedRenders) + " renders skipped, "
+          + toString(governor.throttledSteps) + " steps throttled";
+    // Append the heap allocations of the last frame if they are counted.
+    if (AllocationTracker::isEnabled())
+    {
+      AllocationTracker::Counters frame = AllocationTracker::getFrameCounters();
+      statistics += "\nAllocs/frame: " + toString(frame.allocations) + " (" + toString(frame.bytes) + " bytes)"
+          + "\n  input: " + toString(AllocationTracker::getZoneCounters(AllocationTracker::Input).allocations)
+          + "  update: " + toString(AllocationTracker::getZoneCounters(AllocationTracker::Update).allocations)
+          + "  render: " + toString(AllocationTracker::getZoneCounters(AllocationTracker::Render).allocations);
+    }
+    // Append how the sound effects were handled so far.
+    SoundPlayer::Counters sounds = mSoundPlayer.getCounters();
+    if (sounds.played > 0 || sounds.culled > 0 || sounds.dropped > 0)
+      statistics += "\nSounds: " + toString(sounds.played) + " played, " + toString(sounds.culled) + " culled, "
+          + toString(sounds.stolen) + " stolen, " + toString(sounds.dropped) + " dropped";
+    // Append the glyphs which were rasterized on first use instead of at load time.
+    if (mGlyphs.getMissCount() > 0)
+      statistics += "\nGlyph misses: " + toString(mGlyphs.getMissCount());
+    mStatisticsText.setString(statistics);
+    mGlyphs.check(mStatisticsText);
+    mForceRedraw = true;
     // Minus one second.
     mStatisticsUpdateTime -= sf::seconds(1.0f);
-    // Reset total frames to be zero.
+    // Reset total frames and update cost to be zero.
     mStatisticsNumFrames = 0;
+    mStatisticsUpdateCost = sf::Time::Zero;
+    mStatisticsNumUpdates = 0;
+    mStatisticsLatency = sf::Time::Zero;
+    mStatisticsMaxLatency = sf::Time::Zero;
+    mStatisticsNumLatencies = 0;
+    mStatisticsCpuTime = sf::Time::Zero;
   }
 }
 
 /**
  * Register all game states by initializing all the mStateStack member variable.
+ * The StaticStateStack already knows its states at compile time, so there is nothing to register then.
  */
 void Application::registerStates()
 {
+#ifndef STATIC_STATE_STACK
   mStateStack.registerState<TitleState>(States::Title);
   mStateStack.registerState<MenuState>(States::Menu);
   mStateStack.registerState<GameState>(States::Game);
   mStateStack.registerState<PauseState>(States::Pause);
-}
\ No newline at end of file
+
+  // Keep the states we return to alive, so that the game world is not rebuilt from disk on every round.
+  mStateStack.setCached(States::Menu);
+  mStateStack.setCached(States::Game);
+  mStateStack.setCached(States::Pause);
+#endif
+
+  // The static screens only change on a key press or a slow blink, so they run at a lower frame rate.
+  mStateStack.setFrameRate(States::Title, 30);
+  mStateStack.setFrameRate(States::Menu, 30);
+  mStateStack.setFrameRate(States::Pause, 30);
+  mStateStack.setFrameRate(States::Game, 60);
+}
+
+/**
+ * Rasterize the glyphs of every text the game shows before the first frame. Each state declares its own texts,
+ * the statistics text may show any printable character.
+ */
+void Application::warmUpGlyphs()
+{
+  TitleState::declareGlyphs(mGlyphs);
+  MenuState::declareGlyphs(mGlyphs);
+  PauseState::declareGlyphs(mGlyphs);
+  mGlyphs.declare(Fonts::Main, mStatisticsText.getCharacterSize(), GlyphCache::PrintableCharacters);
+  mGlyphs.warmUp(mFonts);
+}
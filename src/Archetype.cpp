@@ -0,0 +1,174 @@
+// Include project header files
+#include "Archetype.hpp"
+
+// Include C++ standard headers.
+#include <cassert>
+#include <cstring>
+
+/**
+ * Constructor of Archetype class.
+ * @param mask a ComponentMask indicates the set of component types stored.
+ * @param componentSizes an array indicates the size in bytes of every component type by Id.
+ */
+Archetype::Archetype(ComponentMask mask, const std::array<std::size_t, MaxComponentTypes>& componentSizes)
+    : mMask(mask)
+    , mEntities()
+    , mSizes()
+    , mColumns()
+{
+  for (std::size_t id = 0; id < MaxComponentTypes; ++id)
+  {
+    mSizes[id] = (mMask & (ComponentMask(1) << id)) ? componentSizes[id] : 0;
+    // Ensure that every component type of the set was registered with its size.
+    assert(!(mMask & (ComponentMask(1) << id)) || mSizes[id] > 0);
+  }
+}
+
+/**
+ * Get the set of component types stored.
+ * @return a ComponentMask indicates the set of component types.
+ */
+ComponentMask Archetype::getMask() const
+{
+  return mMask;
+}
+
+/**
+ * Get the number of rows.
+ * @return a std::size_t indicates the number of entities stored.
+ */
+std::size_t Archetype::getSize() const
+{
+  return mEntities.size();
+}
+
+/**
+ * Reserve room for rows, so that adding up to that many never reallocates.
+ * @param rows a std::size_t indicates the number of rows.
+ */
+void Archetype::reserve(std::size_t rows)
+{
+  mEntities.reserve(rows);
+  for (std::size_t id = 0; id < MaxComponentTypes; ++id)
+    mColumns[id].reserve(rows * mSizes[id]);
+}
+
+/**
+ * Add a row for an entity, its components are zero until written.
+ * @param entity an EntityId indicates the entity the row belongs to.
+ * @return a std::size_t indicates the new row.
+ */
+std::size_t Archetype::pushBack(EntityId entity)
+{
+  std::size_t row = mEntities.size();
+  mEntities.push_back(entity);
+  for (std::size_t id = 0; id < MaxComponentTypes; ++id)
+    mColumns[id].resize(mColumns[id].size() + mSizes[id]);
+  return row;
+}
+
+/**
+ * Remove a row by moving the last row into it.
+ * @param row a std::size_t indicates the row to remove.
+ * @param moved an EntityId receiving the entity which moved into the row, if any.
+ * @return a bool value indicates whether a row moved(false if the removed row was the last one).
+ */
+bool Archetype::swapRemove(std::size_t row, EntityId& moved)
+{
+  assert(row < mEntities.size());
+
+  std::size_t last = mEntities.size() - 1;
+  bool hasMoved = row != last;
+  if (hasMoved)
+  {
+    mEntities[row] = mEntities[last];
+    moved = mEntities[row];
+    for (std::size_t id = 0; id < MaxComponentTypes; ++id)
+    {
+      if (mSizes[id] > 0)
+        std::memcpy(&mColumns[id][row * mSizes[id]], &mColumns[id][last * mSizes[id]], mSizes[id]);
+    }
+  }
+
+  mEntities.pop_back();
+  for (std::size_t id = 0; id < MaxComponentTypes; ++id)
+    mColumns[id].resize(mColumns[id].size() - mSizes[id]);
+  return hasMoved;
+}
+
+/**
+ * Remove every row, the reserved room is kept.
+ */
+void Archetype::clear()
+{
+  mEntities.clear();
+  for (std::vector<unsigned char>& column : mColumns)
+    column.clear();
+}
+
+/**
+ * Copy every row of another archetype of the same set of component types. The columns are copied as raw bytes, and
+ * the room reserved before is reused, so copying back and forth never reallocates once warmed up.
+ * @param other an Archetype object indicates the archetype to copy.
+ */
+void Archetype::assign(const Archetype& other)
+{
+  assert(mMask == other.mMask);
+
+  mEntities.assign(other.mEntities.begin(), other.mEntities.end());
+  for (std::size_t id = 0; id < MaxComponentTypes; ++id)
+    mColumns[id].assign(other.mColumns[id].begin(), other.mColumns[id].end());
+}
+
+/**
+ * Get the entity of every row.
+ * @return a pointer to the first of getSize() entity ids.
+ */
+const EntityId* Archetype::getEntities() const
+{
+  return mEntities.data();
+}
+
+/**
+ * Get the column of one component type.
+ * @param componentId a std::size_t indicates the Id of the component type, which must be part of the set.
+ * @return a pointer to the component of the first row, the others follow densely.
+ */
+void* Archetype::getColumn(std::size_t componentId)
+{
+  assert(mSizes[componentId] > 0);
+  return mColumns[componentId].data();
+}
+
+/**
+ * Get the column of one component type.
+ * @param componentId a std::size_t indicates the Id of the component type, which must be part of the set.
+ * @return a pointer to the component of the first row, the others follow densely.
+ */
+const void* Archetype::getColumn(std::size_t componentId) const
+{
+  assert(mSizes[componentId] > 0);
+  return mColumns[componentId].data();
+}
+
+/**
+ * Get the component of one component type in one row.
+ * @param componentId a std::size_t indicates the Id of the component type, which must be part of the set.
+ * @param row a std::size_t indicates the row.
+ * @return a pointer to the component.
+ */
+void* Archetype::getComponent(std::size_t componentId, std::size_t row)
+{
+  assert(mSizes[componentId] > 0 && row < mEntities.size());
+  return &mColumns[componentId][row * mSizes[componentId]];
+}
+
+/**
+ * Get the size in bytes of one component type.
+ * @param componentId a std::size_t indicates the Id of the component type.
+ * @return a std::size_t indicates the size, 0 if the type is not part of the set.
+ */
+std::size_t Archetype::getComponentSize(std::size_t componentId) const
+{
+  return mSizes[componentId];
+}
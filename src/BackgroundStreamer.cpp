@@ -0,0 +1,268 @@
+// Include project header files
+#include "BackgroundStreamer.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+
+// Include C++ standard headers.
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * Constructor of BackgroundStreamer class. Every slot gets its pixel buffer and texture now, the chunks visible in
+ * the initial area are generated right away so that the first frame is complete, then the background thread starts.
+ * @param tile a sf::Image object indicates the tile the chunks are filled with.
+ * @param chunkSize a sf::Vector2u indicates the size of every chunk in pixels(and world units).
+ * @param originY a float indicates the y coordinate of the bottom of chunk 0.
+ * @param chunkCount an unsigned int indicates the number of slots, enough for the view plus one chunk ahead.
+ * @param area a sf::FloatRect indicates the area the view initially shows.
+ */
+BackgroundStreamer::BackgroundStreamer(const sf::Image& tile, sf::Vector2u chunkSize, float originY,
+                                       std::size_t chunkCount, const sf::FloatRect& area)
+    : mTilePixels(tile.getPixelsPtr(), tile.getPixelsPtr() + 4 * tile.getSize().x * tile.getSize().y)
+    , mTileSize(tile.getSize())
+    , mChunkSize(chunkSize)
+    , mOriginY(originY)
+    , mVisibleArea(area)
+    , mPrefetching(true)
+    , mSlots(chunkCount)
+    , mMutex()
+    , mCondition()
+    , mRunning(true)
+    , mThread()
+{
+  // Ensure that there is something to tile with.
+  assert(mTileSize.x > 0 && mTileSize.y > 0);
+
+  for (Slot& slot : mSlots)
+  {
+    slot.chunkIndex = 0;
+    slot.state = Free;
+    slot.pixels.resize(4 * mChunkSize.x * mChunkSize.y);
+    slot.texture.reset(new sf::Texture());
+    if (!slot.texture -> create(mChunkSize.x, mChunkSize.y))
+      throw std::runtime_error("BackgroundStreamer::BackgroundStreamer - Failed to create a chunk texture");
+    slot.sprite.setTexture(*slot.texture);
+  }
+
+  // The background thread does not run yet, so the first chunks are generated here.
+  requestChunks();
+  for (Slot& slot : mSlots)
+  {
+    if (slot.state == Pending)
+    {
+      generateChunk(slot.chunkIndex, slot.pixels);
+      uploadChunk(slot);
+    }
+  }
+
+  mThread = std::thread(&BackgroundStreamer::run, this);
+}
+
+/**
+ * Destructor of BackgroundStreamer class, stop the background thread(a chunk it is generating is finished first).
+ */
+BackgroundStreamer::~BackgroundStreamer()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mRunning = false;
+  }
+  mCondition.notify_one();
+  mThread.join();
+}
+
+/**
+ * Set the area the view currently shows, the chunks are requested from it on the next update.
+ * @param area a sf::FloatRect indicates the visible area in world coordinates.
+ */
+void BackgroundStreamer::setVisibleArea(const sf::FloatRect& area)
+{
+  mVisibleArea = area;
+}
+
+/**
+ * Switch requesting the chunk ahead of the view on or off. While it is off, the background thread only generates
+ * the chunks the view actually shows.
+ * @param isPrefetching a bool value indicates whether the chunk ahead of the view is requested.
+ */
+void BackgroundStreamer::setPrefetching(bool isPrefetching)
+{
+  mPrefetching = isPrefetching;
+}
+
+/**
+ * Hand the textures of all slots over, so that they can be released on the main thread while the node is
+ * destroyed elsewhere. The node must not be drawn afterwards.
+ * @param textures a vector receiving the unique_ptr of each texture.
+ */
+void BackgroundStreamer::releaseTextures(std::vector<std::unique_ptr<sf::Texture>>& textures)
+{
+  for (Slot& slot : mSlots)
+    textures.push_back(std::move(slot.texture));
+}
+
+/**
+ * Override updateCurrent method from SceneNode class. Request the chunks needed around the visible area and upload
+ * those the background thread has finished.
+ * @param dt a sf::Time object indicates the current frame time(unused).
+ */
+void BackgroundStreamer::updateCurrent(sf::Time)
+{
+  bool requested = false;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    requested = requestChunks();
+
+    // Generated slots are not touched by the background thread any more.
+    for (Slot& slot : mSlots)
+    {
+      if (slot.state == Generated)
+        uploadChunk(slot);
+    }
+  }
+
+  if (requested)
+    mCondition.notify_one();
+}
+
+/**
+ * Override drawCurrent method from SceneNode class to draw every uploaded chunk.
+ * @param target indicates the sf::RenderTarget object we want to draw to
+ * @param states indicates the current object's parent object's sf::RenderStates(altogether four states, the blend mode
+ * , the transform, the texture, the shader) of the parent node.
+ */
+void BackgroundStreamer::drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  for (const Slot& slot : mSlots)
+  {
+    if (slot.state == Ready)
+      target.draw(slot.sprite, states);
+  }
+}
+
+/**
+ * Hand a slot over to each needed chunk which has none. The needed chunks are those covering the visible area and
+ * the one above it(the view scrolls upward, unless prefetching is off); any slot holding another chunk is recycled, unless the background
+ * thread is writing it. Must be called with mMutex locked or before the background thread starts.
+ * @return a bool value indicates whether a slot became pending.
+ */
+bool BackgroundStreamer::requestChunks()
+{
+  const long first = getChunkIndex(mVisibleArea.top + mVisibleArea.height);
+  const long last = getChunkIndex(mVisibleArea.top) + (mPrefetching ? 1 : 0);
+
+  bool requested = false;
+  for (long index = first; index <= last; ++index)
+  {
+    bool held = false;
+    Slot* recycled = nullptr;
+    for (Slot& slot : mSlots)
+    {
+      if (slot.state != Free && slot.chunkIndex == index)
+      {
+        held = true;
+        break;
+      }
+      if (recycled == nullptr && slot.state != Generating
+          && (slot.state == Free || slot.chunkIndex < first || slot.chunkIndex > last))
+        recycled = &slot;
+    }
+
+    if (held)
+      continue;
+    // Every slot is busy, the remaining chunks are requested again on a later update.
+    if (recycled == nullptr)
+      break;
+
+    recycled -> chunkIndex = index;
+    recycled -> state = Pending;
+    requested = true;
+  }
+  return requested;
+}
+
+/**
+ * Upload the pixels of one generated slot into its texture and place its sprite over the chunk.
+ * @param slot a Slot object indicates the slot whose pixels are complete.
+ */
+void BackgroundStreamer::uploadChunk(Slot& slot)
+{
+  slot.texture -> update(slot.pixels.data());
+  slot.sprite.setPosition(0.f, mOriginY - static_cast<float>((slot.chunkIndex + 1) * mChunkSize.y));
+  slot.state = Ready;
+}
+
+/**
+ * Write the pixels of one chunk by tiling the tile image. Rows follow the world y coordinate, so neighbouring chunks
+ * join seamlessly whatever order they are generated in.
+ * @param chunkIndex a long indicates the index of the chunk.
+ * @param pixels a vector of RGBA pixels receiving the chunk.
+ */
+void BackgroundStreamer::generateChunk(long chunkIndex, std::vector<sf::Uint8>& pixels) const
+{
+  const long top = static_cast<long>(mOriginY) - (chunkIndex + 1) * static_cast<long>(mChunkSize.y);
+  const long tileHeight = static_cast<long>(mTileSize.y);
+
+  for (unsigned int row = 0; row < mChunkSize.y; ++row)
+  {
+    long tileRow = (top + static_cast<long>(row)) % tileHeight;
+    if (tileRow < 0)
+      tileRow += tileHeight;
+
+    const sf::Uint8* source = &mTilePixels[4 * tileRow * mTileSize.x];
+    sf::Uint8* destination = &pixels[4 * row * mChunkSize.x];
+    for (unsigned int x = 0; x < mChunkSize.x; x += mTileSize.x)
+      std::copy(source, source + 4 * std::min(mTileSize.x, mChunkSize.x - x), destination + 4 * x);
+  }
+}
+
+/**
+ * Get the index of the chunk covering a y coordinate.
+ * @param y a float indicates the y coordinate in the world.
+ * @return a long indicates the index of the chunk(0 is the chunk right above the origin).
+ */
+long BackgroundStreamer::getChunkIndex(float y) const
+{
+  return static_cast<long>(std::floor((mOriginY - y) / mChunkSize.y));
+}
+
+/**
+ * Main loop of the background thread, generate pending chunks one by one until we are asked to stop.
+ */
+void BackgroundStreamer::run()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  while (true)
+  {
+    // Sleep until a slot is pending or we have to stop.
+    Slot* pending = nullptr;
+    mCondition.wait(lock, [this, &pending] ()
+    {
+      for (Slot& slot : mSlots)
+      {
+        if (slot.state == Pending)
+        {
+          pending = &slot;
+          return true;
+        }
+      }
+      return !mRunning;
+    });
+
+    if (!mRunning)
+      break;
+
+    // Generate without holding the lock, the main thread leaves a generating slot alone.
+    pending -> state = Generating;
+    const long chunkIndex = pending -> chunkIndex;
+    lock.unlock();
+    generateChunk(chunkIndex, pending -> pixels);
+    lock.lock();
+    pending -> state = Generated;
+  }
+}
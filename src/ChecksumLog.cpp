@@ -0,0 +1,69 @@
+// Include project header files
+#include "ChecksumLog.hpp"
+
+// Include C++ standard headers.
+#include <ios>
+#include <stdexcept>
+
+/**
+ * Constructor of ChecksumLog class, creates(or truncates) the log file.
+ * @param filename a std::string indicates the path of the log file.
+ */
+ChecksumLog::ChecksumLog(const std::string& filename)
+    : mFile(filename.c_str(), std::ios::out | std::ios::trunc)
+{
+  if (!mFile)
+    throw std::runtime_error("ChecksumLog::ChecksumLog - Failed to open " + filename);
+}
+
+/**
+ * Write the checksum of one tick as a "tick checksum" line, the checksum in hexadecimal.
+ * @param tick a std::size_t indicates the tick of the round.
+ * @param checksum a 64-bit integer indicates the world checksum after the tick.
+ */
+void ChecksumLog::write(std::size_t tick, std::uint64_t checksum)
+{
+  mFile << std::dec << tick << ' ' << std::hex << checksum << '\n';
+}
+
+/**
+ * Compare two checksum logs line by line and report the first tick where they diverge. Lines are compared in order,
+ * so logs spanning several rounds(the tick starts from 0 again) are compared correctly.
+ * @param first a std::string indicates the path of the first log.
+ * @param second a std::string indicates the path of the second log.
+ * @param out a std::ostream object indicates where the result is written to.
+ * @return a bool value indicates whether both logs hold the same checksums.
+ */
+bool ChecksumLog::compare(const std::string& first, const std::string& second, std::ostream& out)
+{
+  std::ifstream firstFile(first.c_str());
+  std::ifstream secondFile(second.c_str());
+  if (!firstFile || !secondFile)
+    throw std::runtime_error("ChecksumLog::compare - Failed to open " + (firstFile ? second : first));
+
+  std::size_t firstTick, secondTick;
+  std::uint64_t firstChecksum, secondChecksum;
+  for (std::size_t line = 1; ; ++line)
+  {
+    bool firstRead = static_cast<bool>(firstFile >> std::dec >> firstTick >> std::hex >> firstChecksum);
+    bool secondRead = static_cast<bool>(secondFile >> std::dec >> secondTick >> std::hex >> secondChecksum);
+
+    if (!firstRead && !secondRead)
+    {
+      out << "Checksums match for " << line - 1 << " tick(s)" << std::endl;
+      return true;
+    }
+    if (firstRead != secondRead)
+    {
+      out << "Logs match for " << line - 1 << " tick(s), then " << (firstRead ? second : first) << " ends"
+          << std::endl;
+      return false;
+    }
+    if (firstTick != secondTick || firstChecksum != secondChecksum)
+    {
+      out << "First divergent tick: " << std::dec << firstTick << " (line " << line << "), " << std::hex
+          << firstChecksum << " != " << secondChecksum << std::dec << std::endl;
+      return false;
+    }
+  }
+}
@@ -0,0 +1,139 @@
+// Include project header files
+#include "ClientApplication.hpp"
+#include "Category.hpp"
+#include "NetworkProtocol.hpp"
+#include "Utility.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Graphics/View.hpp>
+#include <SFML/Window/Event.hpp>
+#include <SFML/System/Clock.hpp>
+
+namespace
+{
+  // Frames drawn per second.
+  const unsigned int FrameRate = 60;
+  // Projectiles are drawn like the ones of the ProjectileSystem.
+  const float ProjectileHalfSize = 2.f;
+  const sf::Color AlliedProjectileColor(255, 230, 80);
+  const sf::Color EnemyProjectileColor(255, 80, 200);
+}
+
+/**
+ * Constructor of ClientApplication class, opens the window, loads the textures and connects to the server.
+ * @param server a sf::IpAddress indicates the address of the server.
+ * @param port an unsigned short indicates the port of the server.
+ */
+ClientApplication::ClientApplication(const sf::IpAddress& server, unsigned short port)
+    : mWindow(sf::VideoMode(static_cast<unsigned int>(Network::ViewSize.x),
+                            static_cast<unsigned int>(Network::ViewSize.y)), "Space Shooter Game", sf::Style::Close)
+    , mTextures()
+    , mClient(server, port)
+    , mPacer()
+    , mBackground()
+    , mAircraft()
+    , mProjectiles()
+{
+  mTextures.load(Textures::Eagle, "../Media/Textures/Eagle.png");
+  mTextures.load(Textures::Raptor, "../Media/Textures/Raptor.png");
+  mTextures.load(Textures::Desert, "../Media/Textures/Desert.png");
+
+  // The background tile is repeated over the whole view.
+  sf::Texture& desert = mTextures.get(Textures::Desert);
+  desert.setRepeated(true);
+  mBackground.setTexture(desert);
+
+  mPacer.setTargetFrameRate(FrameRate);
+}
+
+/**
+ * Draw the received snapshots until the window is closed, writing the bandwidth received every second.
+ * @param out a std::ostream object indicates where the bandwidth is written to.
+ */
+void ClientApplication::run(std::ostream& out)
+{
+  sf::Clock statisticsClock;
+  std::uint64_t previousBytes = 0;
+
+  while (mWindow.isOpen())
+  {
+    processInput();
+    mClient.receive();
+
+    const Snapshot* snapshot = mClient.getSnapshot();
+    if (snapshot)
+      render(*snapshot);
+
+    if (statisticsClock.getElapsedTime() >= sf::seconds(1.f))
+    {
+      float seconds = statisticsClock.restart().asSeconds();
+      out << (mClient.getBytesReceived() - previousBytes) / seconds / 1024.f << " KiB/s received" << std::endl;
+      previousBytes = mClient.getBytesReceived();
+    }
+
+    mPacer.waitForNextFrame();
+  }
+}
+
+/**
+ * Handle the events of the window, the client only reacts to closing it.
+ */
+void ClientApplication::processInput()
+{
+  sf::Event event{};
+  while (mWindow.pollEvent(event))
+  {
+    if (event.type == sf::Event::Closed)
+      mWindow.close();
+  }
+}
+
+/**
+ * Draw a snapshot: the background, then every aircraft, then every projectile with one draw call.
+ * @param snapshot a Snapshot object indicates the state to draw.
+ */
+void ClientApplication::render(const Snapshot& snapshot)
+{
+  sf::View view(snapshot.getViewCenter(), Network::ViewSize);
+  mWindow.setView(view);
+  mWindow.clear();
+
+  // Cover the view with the background tile, aligned to the world.
+  sf::Vector2f topLeft = view.getCenter() - view.getSize() / 2.f;
+  sf::IntRect area(static_cast<int>(topLeft.x), static_cast<int>(topLeft.y),
+                   static_cast<int>(view.getSize().x) + 1, static_cast<int>(view.getSize().y) + 1);
+  mBackground.setTextureRect(area);
+  mBackground.setPosition(static_cast<float>(area.left), static_cast<float>(area.top));
+  mWindow.draw(mBackground);
+
+  mProjectiles.clear();
+  for (std::size_t i = 0; i < snapshot.getObjectCount(); ++i)
+  {
+    const unsigned int category = snapshot.getCategory(i);
+    const sf::Vector2f position = snapshot.getPosition(i);
+
+    if (category & (Category::AlliedProjectile | Category::EnemyProjectile))
+    {
+      const sf::Color& color = category & Category::AlliedProjectile ? AlliedProjectileColor : EnemyProjectileColor;
+      const float size = ProjectileHalfSize;
+      mProjectiles.push_back(sf::Vertex(position + sf::Vector2f(-size, -size), color));
+      mProjectiles.push_back(sf::Vertex(position + sf::Vector2f(size, -size), color));
+      mProjectiles.push_back(sf::Vertex(position + sf::Vector2f(size, size), color));
+      mProjectiles.push_back(sf::Vertex(position + sf::Vector2f(-size, size), color));
+      continue;
+    }
+
+    // The player flies the Eagle, every other aircraft is a Raptor and enemies face the player.
+    Textures::ID texture = category & Category::PlayerAircraft ? Textures::Eagle : Textures::Raptor;
+    mAircraft.setTexture(mTextures.get(texture), true);
+    centerOrigin(mAircraft);
+    mAircraft.setPosition(position);
+    mAircraft.setRotation(category & Category::EnemyAircraft ? 180.f : 0.f);
+    mWindow.draw(mAircraft);
+  }
+
+  if (!mProjectiles.empty())
+    mWindow.draw(&mProjectiles[0], mProjectiles.size(), sf::Quads);
+
+  mWindow.display();
+}
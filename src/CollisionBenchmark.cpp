@@ -0,0 +1,87 @@
+// Include project header files
+#include "CollisionBenchmark.hpp"
+#include "CollisionSystem.hpp"
+#include "SceneNode.hpp"
+#include "Category.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/Clock.hpp>
+
+// Include C++ standard headers.
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+  // Every scene is measured for at least this long and at least MinRuns times.
+  const sf::Time MinDuration = sf::seconds(1.f);
+  const std::size_t MinRuns = 3;
+  // Edge length of aircraft and projectile bounds.
+  const float AircraftSize = 48.f;
+  const float ProjectileSize = 4.f;
+}
+
+/**
+ * Measure the broadphase on scenes of 1k, 10k and 100k bodies and write the results.
+ * @param out a std::ostream object indicates where the results are written to.
+ */
+void CollisionBenchmark::run(std::ostream& out)
+{
+  const std::size_t bodyCounts[] = { 1000, 10000, 100000 };
+  for (std::size_t bodyCount : bodyCounts)
+    measure(bodyCount, out);
+}
+
+/**
+ * Measure the broadphase(gathering the bodies included) on one random scene and write the result. The density
+ * stays the same for every size, 1000 bodies share the area of one screen, and most bodies are projectiles.
+ * @param bodyCount a std::size_t indicates the number of bodies in the scene.
+ * @param out a std::ostream object indicates where the result is written to.
+ */
+void CollisionBenchmark::measure(std::size_t bodyCount, std::ostream& out)
+{
+  const float scale = std::sqrt(bodyCount / 1000.f);
+  std::mt19937 random(42);
+  std::uniform_real_distribution<float> xDistribution(0.f, 640.f * scale);
+  std::uniform_real_distribution<float> yDistribution(0.f, 480.f * scale);
+  std::uniform_int_distribution<int> kindDistribution(0, 99);
+
+  std::vector<sf::FloatRect> bounds;
+  std::vector<unsigned int> categories;
+  bounds.reserve(bodyCount);
+  categories.reserve(bodyCount);
+  for (std::size_t i = 0; i < bodyCount; ++i)
+  {
+    int kind = kindDistribution(random);
+    unsigned int category = kind < 1 ? Category::PlayerAircraft
+                          : kind < 5 ? Category::EnemyAircraft
+                          : kind < 50 ? Category::AlliedProjectile
+                          : Category::EnemyProjectile;
+    float size = kind < 5 ? AircraftSize : ProjectileSize;
+    bounds.push_back(sf::FloatRect(xDistribution(random), yDistribution(random), size, size));
+    categories.push_back(category);
+  }
+
+  // Same rules as in the World.
+  CollisionSystem collisions;
+  collisions.allowPair(Category::PlayerAircraft, Category::EnemyAircraft | Category::EnemyProjectile);
+  collisions.allowPair(Category::EnemyAircraft, Category::AlliedProjectile);
+  SceneNode node;
+
+  std::size_t runs = 0;
+  std::size_t pairs = 0;
+  sf::Clock clock;
+  while (clock.getElapsedTime() < MinDuration || runs < MinRuns)
+  {
+    collisions.clear();
+    for (std::size_t i = 0; i < bodyCount; ++i)
+      collisions.addBody(bounds[i], categories[i], node);
+    pairs += collisions.findCandidatePairs().size();
+    ++runs;
+  }
+  float seconds = clock.getElapsedTime().asSeconds();
+
+  out << bodyCount << " bodies: " << pairs / runs << " pairs/run, " << 1000.f * seconds / runs << " ms/run, "
+      << pairs / seconds << " pairs/sec, " << bodyCount * runs / seconds << " bodies/sec" << std::endl;
+}
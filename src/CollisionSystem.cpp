@@ -0,0 +1,135 @@
+// Include project header files
+#include "CollisionSystem.hpp"
+
+// Include C++ standard headers.
+#include <algorithm>
+
+/**
+ * Constructor of CollisionSystem class, no categories interact at first.
+ */
+CollisionSystem::CollisionSystem()
+    : mInteractions()
+    , mBodies()
+    , mPairs()
+    , mPairCapacity(0)
+{
+  mInteractions.fill(0);
+}
+
+/**
+ * Let two categories interact, in both directions. Each argument may combine several categories.
+ * @param first an unsigned int indicates the first categories.
+ * @param second an unsigned int indicates the categories interacting with the first ones.
+ */
+void CollisionSystem::allowPair(unsigned int first, unsigned int second)
+{
+  for (std::size_t bit = 0; bit < mInteractions.size(); ++bit)
+  {
+    if (first & (1u << bit))
+      mInteractions[bit] |= second;
+    if (second & (1u << bit))
+      mInteractions[bit] |= first;
+  }
+}
+
+/**
+ * Reserve room for a number of bodies and candidate pairs. The pairs are capped at that number from then on: once
+ * a broadphase has found that many, it stops, and the remaining overlaps are found by a later tick.
+ * @param bodies a std::size_t indicates the largest number of bodies added between two clears.
+ * @param pairs a std::size_t indicates the largest number of candidate pairs one broadphase reports.
+ */
+void CollisionSystem::reserve(std::size_t bodies, std::size_t pairs)
+{
+  mBodies.reserve(bodies);
+  mPairs.reserve(pairs);
+  mPairCapacity = pairs;
+}
+
+/**
+ * Remove every body, the memory is kept for the next tick.
+ */
+void CollisionSystem::clear()
+{
+  mBodies.clear();
+  mPairs.clear();
+}
+
+/**
+ * Add one body. It is ignored if its category interacts with nothing.
+ * @param bounds a sf::FloatRect indicates the world-space bounding rectangle of the body.
+ * @param category an unsigned int indicates the category of the body.
+ * @param node a SceneNode object indicates the node the body belongs to.
+ * @param index a std::size_t indicates the index of the body inside its node.
+ */
+void CollisionSystem::addBody(const sf::FloatRect& bounds, unsigned int category, SceneNode& node,
+                              std::size_t index)
+{
+  unsigned int interactions = 0;
+  for (std::size_t bit = 0; bit < mInteractions.size(); ++bit)
+  {
+    if (category & (1u << bit))
+      interactions |= mInteractions[bit];
+  }
+
+  if (interactions == 0)
+    return;
+
+  Body body;
+  body.bounds = bounds;
+  body.category = category;
+  body.interactions = interactions;
+  body.node = &node;
+  body.index = index;
+  mBodies.push_back(body);
+}
+
+/**
+ * Sort the bodies along the x axis and sweep them once. For each body, only the following bodies which start
+ * before it ends on the x axis can overlap it, the others are pruned without being looked at. The sweep stops early
+ * once the pair capacity set by reserve() is reached.
+ * @return a vector of Pair structs indicates every pair of allowed categories whose bounds overlap.
+ */
+const std::vector<CollisionSystem::Pair>& CollisionSystem::findCandidatePairs()
+{
+  mPairs.clear();
+
+  std::sort(mBodies.begin(), mBodies.end(), [] (const Body& lhs, const Body& rhs)
+  { return lhs.bounds.left < rhs.bounds.left; });
+
+  for (std::size_t i = 0; i < mBodies.size(); ++i)
+  {
+    const Body& body = mBodies[i];
+    const float right = body.bounds.left + body.bounds.width;
+    const float top = body.bounds.top;
+    const float bottom = body.bounds.top + body.bounds.height;
+
+    for (std::size_t j = i + 1; j < mBodies.size() && mBodies[j].bounds.left < right; ++j)
+    {
+      const Body& other = mBodies[j];
+      if (!(body.interactions & other.category))
+        continue;
+
+      if (other.bounds.top < bottom && top < other.bounds.top + other.bounds.height)
+      {
+        if (mPairCapacity > 0 && mPairs.size() == mPairCapacity)
+          return mPairs;
+
+        Pair pair;
+        pair.first = i;
+        pair.second = j;
+        mPairs.push_back(pair);
+      }
+    }
+  }
+
+  return mPairs;
+}
+
+/**
+ * Get the bodies added since the last clear, sorted along the x axis after findCandidatePairs().
+ * @return a vector of Body structs.
+ */
+const std::vector<CollisionSystem::Body>& CollisionSystem::getBodies() const
+{
+  return mBodies;
+}
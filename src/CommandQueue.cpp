@@ -2,13 +2,22 @@
 #include "CommandQueue.hpp"
 #include "SceneNode.hpp"
 
+/**
+ * Constructor of CommandQueue class.
+ */
+CommandQueue::CommandQueue()
+    : mQueue()
+    , mFront(0)
+{
+}
+
 /**
  * Push a command into the back of the command queue.
  * @param command a Command object indicates a command we want to push to the back.
  */
 void CommandQueue::push(const Command& command)
 {
-  mQueue.push(command);
+  mQueue.push_back(command);
 }
 
 /**
@@ -17,8 +26,17 @@ void CommandQueue::push(const Command& command)
  */
 Command CommandQueue::pop()
 {
-  Command command = mQueue.front();
-  mQueue.pop();
+  // Move the command out instead of copying its std::function.
+  Command command = std::move(mQueue[mFront]);
+  ++mFront;
+
+  // Once drained, empty the vector but keep its capacity for the next tick.
+  if (mFront == mQueue.size())
+  {
+    mQueue.clear();
+    mFront = 0;
+  }
+
   return command;
 }
 
@@ -28,5 +46,5 @@ Command CommandQueue::pop()
  */
 bool CommandQueue::isEmpty() const
 {
-  return mQueue.empty();
-}
\ No newline at end of file
+  return mFront == mQueue.size();
+}
@@ -0,0 +1,31 @@
+// Include project header files
+#include "EmitterNode.hpp"
+
+/**
+ * Constructor of EmitterNode class.
+ * @param particles a ParticleSystem object indicates the system the particles are added to.
+ * @param particlesPerSecond a float indicates how many particles are spawned per second.
+ */
+EmitterNode::EmitterNode(ParticleSystem& particles, float particlesPerSecond)
+    : mParticles(particles)
+    , mInterval(sf::seconds(1.f / particlesPerSecond))
+    , mAccumulatedTime(sf::Time::Zero)
+{
+}
+
+/**
+ * Override updateCurrent method from SceneNode class to spawn the particles due during this frame at the current
+ * world position(a long frame spawns several of them).
+ * @param dt a sf::Time object indicates the current frame time.
+ */
+void EmitterNode::updateCurrent(sf::Time dt)
+{
+  mAccumulatedTime += dt;
+
+  const sf::Vector2f position = getWorldPosition();
+  while (mAccumulatedTime >= mInterval)
+  {
+    mAccumulatedTime -= mInterval;
+    mParticles.spawn(position, sf::Vector2f(0.f, 0.f));
+  }
+}
@@ -1,61 +1,111 @@
 // Include project header files
 #include "Entity.hpp"
+#include "StateHash.hpp"
+#include "Snapshot.hpp"
 
 /**
- * Set current Entity object's velocity by a sf::Vector2f object.
- * @param velocity a sf::Vector2f object indicates the velocity of the current Entity object.
+ * Constructor of Entity class, the entity starts at rest at the origin of its parent.
  */
-void Entity::setVelocity(sf::Vector2f velocity)
+Entity::Entity()
+    : mPosition()
+    , mVelocity()
+{
+}
+
+/**
+ * Set current Entity object's velocity by a Vector2s object.
+ * @param velocity a Vector2s object indicates the velocity of the current Entity object.
+ */
+void Entity::setVelocity(Vector2s velocity)
 {
   this -> mVelocity = velocity;
 }
 
 /**
- * Set current Entity object's velocity by two float.
- * @param vx a float indicates the velocity of current Entity object in x axis.
- * @param vy a float indicates the velocity of current Entity object in y axis.
+ * Set current Entity object's velocity by two Scalar.
+ * @param vx a Scalar indicates the velocity of current Entity object in x axis.
+ * @param vy a Scalar indicates the velocity of current Entity object in y axis.
  */
-void Entity::setVelocity(float vx, float vy)
+void Entity::setVelocity(Scalar vx, Scalar vy)
 {
   this -> mVelocity.x = vx;
   this -> mVelocity.y = vy;
 }
 
 /**
- * Get current Entity object's velocity as a sf::Vector2f object. This method wont modify any member variables.
- * @return a sf::Vector2f object indicates the current Entity object's velocity.
+ * Get current Entity object's velocity as a Vector2s object. This method wont modify any member variables.
+ * @return a Vector2s object indicates the current Entity object's velocity.
  */
-sf::Vector2f Entity::getVelocity() const
+Vector2s Entity::getVelocity() const
 {
   return this -> mVelocity;
 }
 
 /**
- * Accelerate current Entity object by a sf::Vector2f object as velocity.
- * @param velocity a sf::Vector2f indicates the velocity needed to be accelerated.
+ * Accelerate current Entity object by a Vector2s object as velocity.
+ * @param velocity a Vector2s indicates the velocity needed to be accelerated.
  */
-void Entity::accelerate(sf::Vector2f velocity)
+void Entity::accelerate(Vector2s velocity)
 {
   mVelocity += velocity;
 }
 
 /**
- * Accelerate current Entity object by two float as velocity.
- * @param vx a float indicates the velocity needed to be accelerated in x axis.
- * @param vy a float indicates the velocity needed to be accelerated in y axis.
+ * Accelerate current Entity object by two Scalar as velocity.
+ * @param vx a Scalar indicates the velocity needed to be accelerated in x axis.
+ * @param vy a Scalar indicates the velocity needed to be accelerated in y axis.
  */
-void Entity::accelerate(float vx, float vy)
+void Entity::accelerate(Scalar vx, Scalar vy)
 {
   mVelocity.x += vx;
   mVelocity.y += vy;
 }
 
+/**
+ * Place current Entity object relative to its parent, the transform of the node follows.
+ * @param position a Vector2s object indicates the position.
+ */
+void Entity::setSimulatedPosition(Vector2s position)
+{
+  mPosition = position;
+  setPosition(toFloat(mPosition));
+}
+
+/**
+ * Get current Entity object's position relative to its parent.
+ * @return a Vector2s object indicates the position.
+ */
+Vector2s Entity::getSimulatedPosition() const
+{
+  return mPosition;
+}
+
 /**
  * Update the movement of the current Entity object according to the delta time.
  * @param dt a sf::Time object indicates the current frame time.
  */
 void Entity::updateCurrent(sf::Time dt)
 {
-  // Shortcut for setPosition(getPosition() + mVelocity * dt.asSeconds()).
-  move(mVelocity * dt.asSeconds());
+  // Integrate in the simulation's number type, the transform only follows.
+  setSimulatedPosition(mPosition + mVelocity * toScalar(dt));
+}
+
+/**
+ * Add the position, velocity and category of current Entity object to a checksum.
+ * @param hash a StateHash object indicates the checksum.
+ */
+void Entity::hashCurrentState(StateHash& hash)
+{
+  hash.addVector(mPosition);
+  hash.addVector(mVelocity);
+  hash.addInteger(getCategory());
+}
+
+/**
+ * Write the category and world position of current Entity object into a snapshot.
+ * @param snapshot a Snapshot object indicates where the state is written to.
+ */
+void Entity::writeCurrentSnapshot(Snapshot& snapshot)
+{
+  snapshot.addObject(getCategory(), getWorldPosition());
 }
@@ -0,0 +1,295 @@
+// Include project header files
+#include "EntityRegistry.hpp"
+
+// Include C++ standard headers.
+#include <cassert>
+#include <cstring>
+
+/**
+ * Constructor of EntityRegistry class.
+ */
+EntityRegistry::EntityRegistry()
+    : mComponentSizes()
+    , mArchetypes()
+    , mQueries()
+    , mRecords()
+    , mFreeSlots()
+    , mDestroyed()
+    , mCount(0)
+{
+}
+
+/**
+ * Reserve room for entities, so that creating up to that many(and destroying them) never reallocates the records
+ * of the registry. The rows of each archetype are reserved with reserveArchetype().
+ * @param count a std::size_t indicates the number of entities.
+ */
+void EntityRegistry::reserve(std::size_t count)
+{
+  mRecords.reserve(count);
+  mFreeSlots.reserve(count);
+  mDestroyed.reserve(count);
+}
+
+/**
+ * Flag an entity for removal by removeDestroyed(), it stays alive and iterated until then.
+ * @param entity an EntityId indicates the entity, ignored if it is not alive or already flagged.
+ */
+void EntityRegistry::destroy(EntityId entity)
+{
+  if (!isAlive(entity) || mRecords[entity.index].destroyed)
+    return;
+
+  mRecords[entity.index].destroyed = true;
+  mDestroyed.push_back(entity);
+}
+
+/**
+ * Check whether an entity is flagged for removal.
+ * @param entity an EntityId indicates a live entity.
+ * @return a bool value indicates whether the entity is removed by the next removeDestroyed().
+ */
+bool EntityRegistry::isDestroyed(EntityId entity) const
+{
+  assert(isAlive(entity));
+  return mRecords[entity.index].destroyed;
+}
+
+/**
+ * Remove every flagged entity, their slots are reused by the next entities created.
+ */
+void EntityRegistry::removeDestroyed()
+{
+  for (EntityId entity : mDestroyed)
+  {
+    Record& record = mRecords[entity.index];
+    removeRow(record.archetype, record.row);
+
+    record.alive = false;
+    record.destroyed = false;
+    ++record.generation;
+    mFreeSlots.push_back(entity.index);
+    --mCount;
+  }
+  mDestroyed.clear();
+}
+
+/**
+ * Copy every entity and its components into a saved state. Entities must not be flagged for removal. Only the
+ * first save of a state allocates(a copy of each archetype), later saves reuse its room.
+ * @param state a State object receiving the entities.
+ */
+void EntityRegistry::saveState(State& state) const
+{
+  assert(mDestroyed.empty());
+
+  state.records.assign(mRecords.begin(), mRecords.end());
+  state.freeSlots.assign(mFreeSlots.begin(), mFreeSlots.end());
+  state.count = mCount;
+
+  for (std::size_t i = 0; i < mArchetypes.size(); ++i)
+  {
+    if (i == state.archetypes.size())
+      state.archetypes.push_back(std::unique_ptr<Archetype>(new Archetype(mArchetypes[i] -> getMask(),
+                                                                          mComponentSizes)));
+    state.archetypes[i] -> assign(*mArchetypes[i]);
+  }
+}
+
+/**
+ * Bring every entity and its components back from a state saved by this registry. Archetypes created since then
+ * are kept but emptied, so the cached queries stay valid. Handles of entities created since then are stale.
+ * @param state a State object indicates the saved entities.
+ */
+void EntityRegistry::restoreState(const State& state)
+{
+  assert(state.archetypes.size() <= mArchetypes.size());
+
+  mRecords.assign(state.records.begin(), state.records.end());
+  mFreeSlots.assign(state.freeSlots.begin(), state.freeSlots.end());
+  mCount = state.count;
+  mDestroyed.clear();
+
+  for (std::size_t i = 0; i < mArchetypes.size(); ++i)
+  {
+    if (i < state.archetypes.size())
+      mArchetypes[i] -> assign(*state.archetypes[i]);
+    else
+      mArchetypes[i] -> clear();
+  }
+}
+
+/**
+ * Remove every entity. The archetypes, queries and reserved room are kept, handles from before are stale.
+ */
+void EntityRegistry::clear()
+{
+  for (std::unique_ptr<Archetype>& archetype : mArchetypes)
+    archetype -> clear();
+
+  mFreeSlots.clear();
+  for (std::size_t i = mRecords.size(); i > 0; --i)
+  {
+    Record& record = mRecords[i - 1];
+    if (record.alive)
+    {
+      record.alive = false;
+      record.destroyed = false;
+      ++record.generation;
+    }
+    mFreeSlots.push_back(static_cast<std::uint32_t>(i - 1));
+  }
+  mDestroyed.clear();
+  mCount = 0;
+}
+
+/**
+ * Check whether an entity handle refers to a live entity.
+ * @param entity an EntityId indicates the entity.
+ * @return a bool value indicates whether the entity is alive(flagged entities are still alive).
+ */
+bool EntityRegistry::isAlive(EntityId entity) const
+{
+  return entity.index < mRecords.size() && mRecords[entity.index].alive
+         && mRecords[entity.index].generation == entity.generation;
+}
+
+/**
+ * Get the handle of the live entity in a slot, e.g. from the index of a collision body.
+ * @param index an unsigned int indicates the slot of a live entity.
+ * @return an EntityId indicates the entity.
+ */
+EntityId EntityRegistry::getEntity(std::uint32_t index) const
+{
+  assert(index < mRecords.size() && mRecords[index].alive);
+
+  EntityId entity = { index, mRecords[index].generation };
+  return entity;
+}
+
+/**
+ * Get the number of live entities.
+ * @return a std::size_t indicates the number of live entities(flagged ones included).
+ */
+std::size_t EntityRegistry::getCount() const
+{
+  return mCount;
+}
+
+/**
+ * Get the archetype of a set of component types. A new archetype is added to every query it matches.
+ * @param mask a ComponentMask indicates the set of component types.
+ * @return a std::size_t indicates the index of the archetype.
+ */
+std::size_t EntityRegistry::findArchetype(ComponentMask mask)
+{
+  for (std::size_t i = 0; i < mArchetypes.size(); ++i)
+  {
+    if (mArchetypes[i] -> getMask() == mask)
+      return i;
+  }
+
+  mArchetypes.push_back(std::unique_ptr<Archetype>(new Archetype(mask, mComponentSizes)));
+  std::size_t index = mArchetypes.size() - 1;
+  for (Query& query : mQueries)
+  {
+    if ((mask & query.mask) == query.mask)
+      query.archetypes.push_back(index);
+  }
+  return index;
+}
+
+/**
+ * Get the query of a set of component types. A new query collects the matching archetypes once, it is kept up to
+ * date by findArchetype() afterwards.
+ * @param mask a ComponentMask indicates the set of component types.
+ * @return a Query object indicates the archetypes having all the component types.
+ */
+const EntityRegistry::Query& EntityRegistry::findQuery(ComponentMask mask)
+{
+  for (const Query& query : mQueries)
+  {
+    if (query.mask == mask)
+      return query;
+  }
+
+  Query query;
+  query.mask = mask;
+  for (std::size_t i = 0; i < mArchetypes.size(); ++i)
+  {
+    if ((mArchetypes[i] -> getMask() & mask) == mask)
+      query.archetypes.push_back(i);
+  }
+  mQueries.push_back(std::move(query));
+  return mQueries.back();
+}
+
+/**
+ * Take a free slot(or a new one) for a new entity.
+ * @return an EntityId indicates the new entity, its record still has to be placed.
+ */
+EntityId EntityRegistry::allocateSlot()
+{
+  std::uint32_t index;
+  if (!mFreeSlots.empty())
+  {
+    index = mFreeSlots.back();
+    mFreeSlots.pop_back();
+  }
+  else
+  {
+    index = static_cast<std::uint32_t>(mRecords.size());
+    Record record = { 0, 0, 0, false, false };
+    mRecords.push_back(record);
+  }
+
+  Record& record = mRecords[index];
+  record.alive = true;
+  record.destroyed = false;
+  ++mCount;
+
+  EntityId entity = { index, record.generation };
+  return entity;
+}
+
+/**
+ * Move an entity into the archetype of another set of component types. The components both sets share are copied,
+ * the new ones are zero.
+ * @param entity an EntityId indicates a live entity.
+ * @param mask a ComponentMask indicates the new set of component types.
+ */
+void EntityRegistry::moveEntity(EntityId entity, ComponentMask mask)
+{
+  Record& record = mRecords[entity.index];
+  std::size_t sourceIndex = record.archetype;
+  std::size_t sourceRow = record.row;
+  std::size_t targetIndex = findArchetype(mask);
+
+  Archetype& source = *mArchetypes[sourceIndex];
+  Archetype& target = *mArchetypes[targetIndex];
+  std::size_t targetRow = target.pushBack(entity);
+
+  ComponentMask shared = source.getMask() & mask;
+  for (std::size_t id = 0; id < MaxComponentTypes; ++id)
+  {
+    if (shared & (ComponentMask(1) << id))
+      std::memcpy(target.getComponent(id, targetRow), source.getComponent(id, sourceRow),
+                  source.getComponentSize(id));
+  }
+
+  removeRow(sourceIndex, sourceRow);
+  record.archetype = targetIndex;
+  record.row = targetRow;
+}
+
+/**
+ * Remove the row of an entity from its archetype, the entity moved into that row gets its record fixed.
+ * @param archetype a std::size_t indicates the index of the archetype.
+ * @param row a std::size_t indicates the row to remove.
+ */
+void EntityRegistry::removeRow(std::size_t archetype, std::size_t row)
+{
+  EntityId moved;
+  if (mArchetypes[archetype] -> swapRemove(row, moved))
+    mRecords[moved.index].row = row;
+}
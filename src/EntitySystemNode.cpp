@@ -0,0 +1,231 @@
+// Include project header files
+#include "EntitySystemNode.hpp"
+#include "CollisionSystem.hpp"
+#include "StateHash.hpp"
+#include "Snapshot.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+// Include C++ standard headers.
+#include <cmath>
+
+namespace
+{
+  const float Pi = 3.14159265f;
+}
+
+/**
+ * Constructor of EntitySystemNode class.
+ */
+EntitySystemNode::EntitySystemNode()
+    : mRegistry()
+    , mBatches()
+{
+}
+
+/**
+ * Get the registry of the entities, game specific systems iterate it directly.
+ * @return an EntityRegistry object indicates the registry.
+ */
+EntityRegistry& EntitySystemNode::getRegistry()
+{
+  return mRegistry;
+}
+
+/**
+ * Reserve room for entities drawn with a texture, so that drawing up to that many of them never allocates.
+ * @param texture a sf::Texture object indicates the texture.
+ * @param count a std::size_t indicates the number of entities.
+ */
+void EntitySystemNode::reserveTexture(const sf::Texture& texture, std::size_t count)
+{
+  findBatch(&texture).reserve(count * 4);
+}
+
+/**
+ * Remove every entity flagged for removal. The quads are written again, so that removed entities are not drawn.
+ */
+void EntitySystemNode::removeDestroyed()
+{
+  mRegistry.removeDestroyed();
+  writeBatches();
+}
+
+/**
+ * Bring the entities back from a state saved by the registry. The quads are written again, so that the restored
+ * entities are drawn where they were.
+ * @param state an EntityRegistry::State object indicates the saved entities.
+ */
+void EntitySystemNode::restoreState(const EntityRegistry::State& state)
+{
+  mRegistry.restoreState(state);
+  writeBatches();
+}
+
+/**
+ * Override updateCurrent method from SceneNode class. Run the movement system over the packed columns, then write
+ * the quads of the moved entities.
+ * @param dt a sf::Time object indicates the current frame time.
+ */
+void EntitySystemNode::updateCurrent(sf::Time dt)
+{
+  const Scalar seconds = toScalar(dt);
+
+  mRegistry.each<Components::Position, Components::Velocity>(
+      [seconds] (std::size_t count, const EntityId*, Components::Position* positions,
+                 Components::Velocity* velocities)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      positions[i].x += velocities[i].x * seconds;
+      positions[i].y += velocities[i].y * seconds;
+    }
+  });
+
+  writeBatches();
+}
+
+/**
+ * Add the collider of every entity as a collision body, the body index is the entity's slot.
+ * @param collisions a CollisionSystem object indicates where the bodies are added.
+ */
+void EntitySystemNode::collectCurrentBodies(CollisionSystem& collisions)
+{
+  mRegistry.each<Components::Position, Components::Collider>(
+      [this, &collisions] (std::size_t count, const EntityId* entities, Components::Position* positions,
+                           Components::Collider* colliders)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      sf::FloatRect bounds(toFloat(positions[i].x) - colliders[i].halfWidth,
+                           toFloat(positions[i].y) - colliders[i].halfHeight,
+                           2.f * colliders[i].halfWidth, 2.f * colliders[i].halfHeight);
+      collisions.addBody(bounds, colliders[i].category, *this, entities[i].index);
+    }
+  });
+}
+
+/**
+ * Add the number of entities, then the slot, position, velocity and category of each one to a checksum.
+ * @param hash a StateHash object indicates the checksum.
+ */
+void EntitySystemNode::hashCurrentState(StateHash& hash)
+{
+  hash.addInteger(mRegistry.getCount());
+  mRegistry.each<Components::Position, Components::Velocity, Components::Collider>(
+      [&hash] (std::size_t count, const EntityId* entities, Components::Position* positions,
+               Components::Velocity* velocities, Components::Collider* colliders)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      hash.addInteger(entities[i].index);
+      hash.addScalar(positions[i].x);
+      hash.addScalar(positions[i].y);
+      hash.addScalar(velocities[i].x);
+      hash.addScalar(velocities[i].y);
+      hash.addInteger(colliders[i].category);
+    }
+  });
+}
+
+/**
+ * Write the category and position of every entity with a collider into a snapshot.
+ * @param snapshot a Snapshot object indicates where the state is written to.
+ */
+void EntitySystemNode::writeCurrentSnapshot(Snapshot& snapshot)
+{
+  mRegistry.each<Components::Position, Components::Collider>(
+      [&snapshot] (std::size_t count, const EntityId*, Components::Position* positions,
+                   Components::Collider* colliders)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+      snapshot.addObject(colliders[i].category, sf::Vector2f(toFloat(positions[i].x), toFloat(positions[i].y)));
+  });
+}
+
+/**
+ * Draw the entities with one draw call per texture.
+ * @param target indicates the sf::RenderTarget object we want to draw to
+ * @param states indicates the render states of the parent node
+ */
+void EntitySystemNode::drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const
+{
+  for (const Batch& batch : mBatches)
+  {
+    if (batch.vertices.empty())
+      continue;
+
+    states.texture = batch.texture;
+    target.draw(&batch.vertices[0], batch.vertices.size(), sf::Quads, states);
+  }
+}
+
+/**
+ * Write the quad of every entity with a sprite into the batch of its texture, rotated around the entity's position.
+ */
+void EntitySystemNode::writeBatches()
+{
+  for (Batch& batch : mBatches)
+    batch.vertices.clear();
+
+  mRegistry.each<Components::Position, Components::Sprite>(
+      [this] (std::size_t count, const EntityId*, Components::Position* positions, Components::Sprite* sprites)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const Components::Sprite& sprite = sprites[i];
+      const float x = toFloat(positions[i].x);
+      const float y = toFloat(positions[i].y);
+      const sf::IntRect& rect = sprite.textureRect;
+      const float radians = sprite.rotation * Pi / 180.f;
+      const float cosine = std::cos(radians);
+      const float sine = std::sin(radians);
+      const float halfWidth = rect.width / 2.f;
+      const float halfHeight = rect.height / 2.f;
+
+      // Corners relative to the center, then their texture coordinates.
+      const sf::Vector2f corners[4] =
+      {
+        sf::Vector2f(-halfWidth, -halfHeight), sf::Vector2f(halfWidth, -halfHeight),
+        sf::Vector2f(halfWidth, halfHeight), sf::Vector2f(-halfWidth, halfHeight),
+      };
+      const float left = static_cast<float>(rect.left);
+      const float top = static_cast<float>(rect.top);
+      const float right = static_cast<float>(rect.left + rect.width);
+      const float bottom = static_cast<float>(rect.top + rect.height);
+      const sf::Vector2f texCoords[4] =
+      {
+        sf::Vector2f(left, top), sf::Vector2f(right, top), sf::Vector2f(right, bottom), sf::Vector2f(left, bottom),
+      };
+
+      std::vector<sf::Vertex>& vertices = findBatch(sprite.texture);
+      for (int corner = 0; corner < 4; ++corner)
+      {
+        sf::Vector2f position(x + corners[corner].x * cosine - corners[corner].y * sine,
+                              y + corners[corner].x * sine + corners[corner].y * cosine);
+        vertices.push_back(sf::Vertex(position, texCoords[corner]));
+      }
+    }
+  });
+}
+
+/**
+ * Get the batch of a texture, creating it if needed(batches are only created, so they stay in a stable order).
+ * @param texture a pointer to the texture.
+ * @return a vector of the vertices drawn with the texture.
+ */
+std::vector<sf::Vertex>& EntitySystemNode::findBatch(const sf::Texture* texture)
+{
+  for (Batch& batch : mBatches)
+  {
+    if (batch.texture == texture)
+      return batch.vertices;
+  }
+
+  Batch batch;
+  batch.texture = texture;
+  mBatches.push_back(std::move(batch));
+  return mBatches.back().vertices;
+}
@@ -0,0 +1,144 @@
+// Include project header files
+#include "FrameGovernor.hpp"
+
+namespace
+{
+  // Enter degraded mode once a step costs more than this share of the fixed time step on average.
+  const float DegradeThreshold = 0.75f;
+  // Leave degraded mode once a step costs less than this share of the fixed time step on average.
+  const float RecoverThreshold = 0.5f;
+  // Weight of the newest step in the moving average of the step cost.
+  const float CostSmoothing = 0.1f;
+  // In degraded mode, only one frame out of this many is rendered.
+  const std::size_t DegradedRenderInterval = 2;
+}
+
+/**
+ * Constructor of the Counters struct, all counters start at zero.
+ */
+FrameGovernor::Counters::Counters()
+    : cappedFrames(0)
+    , droppedTime(sf::Time::Zero)
+    , degradedFrames(0)
+    , skippedRenders(0)
+    , throttledSteps(0)
+{
+}
+
+/**
+ * Constructor of FrameGovernor class.
+ * @param timePerFrame a sf::Time object indicates the fixed time step.
+ * @param maxStepsPerFrame a std::size_t indicates how many fixed steps may run in one real frame at most.
+ */
+FrameGovernor::FrameGovernor(sf::Time timePerFrame, std::size_t maxStepsPerFrame)
+    : mTimePerFrame(timePerFrame)
+    , mMaxStepsPerFrame(maxStepsPerFrame)
+    , mAccumulated(sf::Time::Zero)
+    , mStepsThisFrame(0)
+    , mAverageStepCost(0.f)
+    , mDegraded(false)
+    , mFramesSinceRender(0)
+    , mCounters()
+{
+}
+
+/**
+ * Start a new real frame and decide whether the previous ones were too expensive.
+ * @param elapsed a sf::Time object indicates the real time elapsed since the previous frame.
+ */
+void FrameGovernor::beginFrame(sf::Time elapsed)
+{
+  mAccumulated += elapsed;
+  mStepsThisFrame = 0;
+
+  // Switch between normal and degraded mode with some hysteresis, so that we do not flip every frame.
+  float budget = mTimePerFrame.asSeconds();
+  if (mAverageStepCost > DegradeThreshold * budget)
+    mDegraded = true;
+  else if (mAverageStepCost < RecoverThreshold * budget)
+    mDegraded = false;
+
+  if (mDegraded)
+    mCounters.degradedFrames += 1;
+}
+
+/**
+ * Check whether one more fixed step should run in the current frame. Once the cap is reached, the simulation
+ * time that is still owed is dropped(except for the part smaller than one step), so the next frame starts fresh.
+ * @return a bool value indicates whether the caller should run one more fixed step.
+ */
+bool FrameGovernor::nextStep()
+{
+  if (mAccumulated < mTimePerFrame)
+    return false;
+
+  if (mStepsThisFrame >= mMaxStepsPerFrame)
+  {
+    sf::Time remainder = mAccumulated % mTimePerFrame;
+    mCounters.droppedTime += mAccumulated - remainder;
+    mCounters.cappedFrames += 1;
+    mAccumulated = remainder;
+    // Running this far behind means we are overloaded, whatever the average says.
+    mDegraded = true;
+    return false;
+  }
+
+  mAccumulated -= mTimePerFrame;
+  mStepsThisFrame += 1;
+  if (mDegraded)
+    mCounters.throttledSteps += 1;
+  return true;
+}
+
+/**
+ * Record how long the last fixed step took.
+ * @param cost a sf::Time object indicates the real time spent in the last fixed step.
+ */
+void FrameGovernor::endStep(sf::Time cost)
+{
+  mAverageStepCost += CostSmoothing * (cost.asSeconds() - mAverageStepCost);
+}
+
+/**
+ * Check whether the current frame should be rendered. Every frame is rendered normally, in degraded mode only
+ * one out of DegradedRenderInterval frames is, which leaves more of the frame to the simulation.
+ * @return a bool value indicates whether the caller should render.
+ */
+bool FrameGovernor::shouldRender()
+{
+  if (!mDegraded || ++mFramesSinceRender >= DegradedRenderInterval)
+  {
+    mFramesSinceRender = 0;
+    return true;
+  }
+
+  mCounters.skippedRenders += 1;
+  return false;
+}
+
+/**
+ * Check whether the governor is in degraded mode.
+ * @return a bool value indicates whether the governor is in degraded mode.
+ */
+bool FrameGovernor::isDegraded() const
+{
+  return mDegraded;
+}
+
+/**
+ * Get the average cost of one fixed step.
+ * @return a sf::Time object indicates the moving average of the step cost.
+ */
+sf::Time FrameGovernor::getAverageStepCost() const
+{
+  return sf::seconds(mAverageStepCost);
+}
+
+/**
+ * Get the counters which report how often the governor stepped in.
+ * @return a const reference to the Counters struct.
+ */
+const FrameGovernor::Counters& FrameGovernor::getCounters() const
+{
+  return mCounters;
+}
@@ -0,0 +1,124 @@
+// Include project header files
+#include "FramePacer.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/Sleep.hpp>
+
+// Include C++ standard headers.
+#include <algorithm>
+#include <thread>
+
+// Include platform headers for the process CPU time.
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace
+{
+  // Bounds of the time spent spinning before a deadline.
+  const sf::Time MinSpinTime = sf::microseconds(500);
+  const sf::Time MaxSpinTime = sf::milliseconds(2);
+}
+
+/**
+ * Constructor of FramePacer class, there is no frame rate limit by default.
+ */
+FramePacer::FramePacer()
+    : mClock()
+    , mFrameTime(sf::Time::Zero)
+    , mFrameStart(sf::Time::Zero)
+    , mSpinTime(MinSpinTime)
+    , mFrameCpuStart(getProcessCpuTime())
+    , mLastFrameCpuTime(sf::Time::Zero)
+{
+}
+
+/**
+ * Set the target frame rate.
+ * @param framesPerSecond an unsigned int indicates the target frame rate, 0 means no limit.
+ */
+void FramePacer::setTargetFrameRate(unsigned int framesPerSecond)
+{
+  mFrameTime = framesPerSecond > 0 ? sf::seconds(1.f / framesPerSecond) : sf::Time::Zero;
+}
+
+/**
+ * Wait until the next frame is due and start it. We sleep until mSpinTime before the deadline and spin for the
+ * rest, then adapt mSpinTime to how much the sleep overshot.
+ */
+void FramePacer::waitForNextFrame()
+{
+  if (mFrameTime != sf::Time::Zero)
+  {
+    sf::Time deadline = mFrameStart + mFrameTime;
+    sf::Time remaining = deadline - mClock.getElapsedTime();
+
+    // Sleep for most of the remaining time.
+    if (remaining > mSpinTime)
+    {
+      sf::Time sleepTime = remaining - mSpinTime;
+      sf::Time beforeSleep = mClock.getElapsedTime();
+      sf::sleep(sleepTime);
+      sf::Time overshoot = mClock.getElapsedTime() - beforeSleep - sleepTime;
+
+      // Keep the spin margin a bit above the overshoot we observe, within bounds.
+      mSpinTime = std::max(MinSpinTime, std::min(MaxSpinTime, (mSpinTime * 7.f + overshoot * 2.f) / 8.f));
+    }
+
+    // Spin for the last fraction of a millisecond.
+    while (mClock.getElapsedTime() < deadline)
+      std::this_thread::yield();
+
+    // Keep a steady cadence, unless we are more than one frame late(then we start over from now).
+    sf::Time now = mClock.getElapsedTime();
+    mFrameStart = (now - deadline > mFrameTime) ? now : deadline;
+  }
+  else
+  {
+    mFrameStart = mClock.getElapsedTime();
+  }
+
+  // Measure the CPU time of the frame which just ended.
+  sf::Time cpuTime = getProcessCpuTime();
+  mLastFrameCpuTime = cpuTime - mFrameCpuStart;
+  mFrameCpuStart = cpuTime;
+}
+
+/**
+ * Get the CPU time the process used during the last frame(all threads, including the time spent spinning).
+ * @return a sf::Time indicates the CPU time of the last frame.
+ */
+sf::Time FramePacer::getLastFrameCpuTime() const
+{
+  return mLastFrameCpuTime;
+}
+
+/**
+ * Get the CPU time the process used since it started, summed over all of its threads.
+ * @return a sf::Time indicates the user and kernel CPU time of the process.
+ */
+sf::Time FramePacer::getProcessCpuTime()
+{
+#ifdef _WIN32
+  FILETIME creation, exit, kernel, user;
+  if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+    return sf::Time::Zero;
+
+  // FILETIME counts in units of 100 nanoseconds.
+  ULARGE_INTEGER kernelTime, userTime;
+  kernelTime.LowPart = kernel.dwLowDateTime;
+  kernelTime.HighPart = kernel.dwHighDateTime;
+  userTime.LowPart = user.dwLowDateTime;
+  userTime.HighPart = user.dwHighDateTime;
+  return sf::microseconds(static_cast<sf::Int64>((kernelTime.QuadPart + userTime.QuadPart) / 10));
+#else
+  timespec time;
+  if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time) != 0)
+    return sf::Time::Zero;
+
+  return sf::microseconds(static_cast<sf::Int64>(time.tv_sec) * 1000000 + time.tv_nsec / 1000);
+#endif
+}
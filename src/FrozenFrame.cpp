@@ -0,0 +1,67 @@
+// Include project header files
+#include "FrozenFrame.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Graphics/RenderWindow.hpp>
+
+// Include C++ standard headers.
+#include <stdexcept>
+
+/**
+ * Constructor of FrozenFrame class, there is no copied frame at first.
+ */
+FrozenFrame::FrozenFrame()
+    : mTexture()
+    , mSprite()
+    , mValid(false)
+{
+}
+
+/**
+ * Copy what was drawn to the window so far(the window's back buffer, before it is displayed).
+ * @param window a sf::RenderWindow object indicates the window the frozen states were drawn to.
+ */
+void FrozenFrame::capture(const sf::RenderWindow& window)
+{
+  sf::Vector2u windowSize = window.getSize();
+  // Only recreate the texture when the window size changed.
+  if (mTexture.getSize() != windowSize)
+  {
+    if (!mTexture.create(windowSize.x, windowSize.y))
+      throw std::runtime_error("FrozenFrame::capture - Failed to create a texture of the window size");
+    mSprite.setTexture(mTexture, true);
+  }
+  mTexture.update(window);
+
+  // The copy has the window's pixel size, stretch it back over the default view.
+  sf::Vector2f viewSize = window.getDefaultView().getSize();
+  mSprite.setScale(viewSize.x / windowSize.x, viewSize.y / windowSize.y);
+  mValid = true;
+}
+
+/**
+ * Draw the copied frame as one quad covering the default view.
+ * @param window a sf::RenderWindow object indicates the window to draw to.
+ */
+void FrozenFrame::draw(sf::RenderWindow& window) const
+{
+  window.setView(window.getDefaultView());
+  window.draw(mSprite);
+}
+
+/**
+ * Forget the copied frame, the next draw has to capture it again.
+ */
+void FrozenFrame::invalidate()
+{
+  mValid = false;
+}
+
+/**
+ * Check whether a copied frame is available.
+ * @return a bool value indicates whether the copied frame is up to date.
+ */
+bool FrozenFrame::isValid() const
+{
+  return mValid;
+}
@@ -0,0 +1,289 @@
+// Include project header files
+#include "GameServer.hpp"
+#include "NullSoundBackend.hpp"
+#include "SoundSynthesizer.hpp"
+#include "Utility.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/Sleep.hpp>
+
+// Include C++ standard headers.
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+  // The server plays nothing, one voice is enough.
+  const std::size_t SoundVoiceCount = 1;
+  // A client which has not been served a snapshot this long after connecting is reported.
+  const sf::Time UnservedWarningDelay = sf::seconds(1.f);
+  // Ticks the server catches up at most when it falls behind, anything beyond that is dropped.
+  const std::size_t MaxTicksPerWake = 5;
+  // Room for the objects of a snapshot, reserved for every tick of the history.
+  const std::size_t SnapshotCapacity = 4096;
+}
+
+/**
+ * Constructor of GameServer class, binds the socket and builds the world.
+ * @param port an unsigned short indicates the port to listen on, 0 picks any free port.
+ */
+GameServer::GameServer(unsigned short port)
+    : mSoundBuffers()
+    , mSoundPlayer(SoundSynthesizer::synthesizeAll(mSoundBuffers), SoundBackend::Ptr(new NullSoundBackend(SoundVoiceCount)))
+    , mWorld(Network::ViewSize, mSoundPlayer)
+    , mSocket()
+    , mClients()
+    , mHistory()
+    , mTick(0)
+    , mClock()
+    , mPacket()
+    , mBody()
+    , mStatistics()
+{
+  if (mSocket.bind(port) != sf::Socket::Done)
+    throw std::runtime_error("GameServer::GameServer - Failed to bind port " + toString(port));
+  mSocket.setBlocking(false);
+
+  for (Snapshot& snapshot : mHistory)
+    snapshot.reserve(SnapshotCapacity);
+}
+
+/**
+ * Handle the datagrams of the clients, simulate one tick and send the snapshot of it to every client.
+ */
+void GameServer::tick()
+{
+  receive();
+
+  mWorld.update(Network::TimePerTick);
+  Snapshot& snapshot = mHistory[mTick % Network::HistorySize];
+  snapshot.setTick(mTick);
+  mWorld.writeSnapshot(snapshot);
+
+  sendSnapshots();
+  ++mTick;
+  ++mStatistics.ticks;
+}
+
+/**
+ * Tick at the game's rate until the process is stopped. Every second, the tick rate and the bandwidth sent to each
+ * client are written, and every client which was never served a snapshot although it connected a while ago.
+ * @param out a std::ostream object indicates where the statistics are written to.
+ */
+void GameServer::run(std::ostream& out)
+{
+  out << "Server listening on port " << getPort() << std::endl;
+
+  sf::Clock clock;
+  sf::Time lag = sf::Time::Zero;
+  sf::Time statisticsTime = sf::Time::Zero;
+  Statistics previous = mStatistics;
+  for (;;)
+  {
+    sf::Time elapsed = clock.restart();
+    lag = std::min(lag + elapsed, Network::TimePerTick * static_cast<float>(MaxTicksPerWake));
+    statisticsTime += elapsed;
+
+    while (lag >= Network::TimePerTick)
+    {
+      lag -= Network::TimePerTick;
+      tick();
+    }
+
+    if (statisticsTime >= sf::seconds(1.f))
+    {
+      float seconds = statisticsTime.asSeconds();
+      std::size_t snapshots = mStatistics.snapshots - previous.snapshots;
+      std::uint64_t bytes = mStatistics.bytesSent - previous.bytesSent;
+      out << (mStatistics.ticks - previous.ticks) / seconds << " ticks/s, " << mClients.size() << " client(s), "
+          << (mClients.empty() ? 0.f : bytes / seconds / mClients.size() / 1024.f) << " KiB/s per client, "
+          << (snapshots == 0 ? 0 : bytes / snapshots) << " bytes per snapshot, "
+          << mStatistics.fragmented - previous.fragmented << " fragmented, "
+          << mStatistics.oversized - previous.oversized << " oversized" << std::endl;
+
+      const sf::Time now = mClock.getElapsedTime();
+      for (const Client& client : mClients)
+      {
+        if (!client.isServed && now - client.connected >= UnservedWarningDelay)
+          out << "Client " << client.address.toString() << ":" << client.port << " has not been served any snapshot yet"
+              << std::endl;
+      }
+      previous = mStatistics;
+      statisticsTime = sf::Time::Zero;
+    }
+
+    sf::sleep(Network::TimePerTick - lag);
+  }
+}
+
+/**
+ * Get the port the server listens on.
+ * @return an unsigned short indicates the port.
+ */
+unsigned short GameServer::getPort() const
+{
+  return mSocket.getLocalPort();
+}
+
+/**
+ * Get the number of connected clients.
+ * @return a std::size_t indicates the number of clients.
+ */
+std::size_t GameServer::getClientCount() const
+{
+  return mClients.size();
+}
+
+/**
+ * Get what the server did so far.
+ * @return a Statistics object indicates the counters.
+ */
+const GameServer::Statistics& GameServer::getStatistics() const
+{
+  return mStatistics;
+}
+
+/**
+ * Handle every datagram waiting on the socket, then drop the clients which timed out.
+ */
+void GameServer::receive()
+{
+  const sf::Time now = mClock.getElapsedTime();
+  sf::IpAddress address;
+  unsigned short port;
+  while (mSocket.receive(mPacket, address, port) == sf::Socket::Done)
+  {
+    sf::Uint8 message;
+    if (!(mPacket >> message))
+      continue;
+
+    Client* client = findClient(address, port);
+    if (message == Network::Connect && !client)
+    {
+      Client newClient = { address, port, Snapshot::NoTick, now, now, false };
+      mClients.push_back(newClient);
+    }
+    else if (message == Network::Disconnect && client)
+    {
+      mClients.erase(mClients.begin() + (client - mClients.data()));
+      continue;
+    }
+    else if (message == Network::Acknowledge && client)
+    {
+      // Datagrams can arrive out of order, only a newer snapshot becomes the baseline.
+      sf::Uint32 tick;
+      if ((mPacket >> tick) && tick < mTick
+          && (client -> acknowledgedTick == Snapshot::NoTick || tick > client -> acknowledgedTick))
+        client -> acknowledgedTick = tick;
+    }
+
+    if (client)
+      client -> lastHeard = now;
+  }
+
+  mClients.erase(std::remove_if(mClients.begin(), mClients.end(), [now] (const Client& client)
+  { return now - client.lastHeard > Network::ClientTimeout; }), mClients.end());
+}
+
+/**
+ * Send the snapshot of the current tick to every client. Clients sharing a baseline(usually all of them, the one of
+ * the previous tick) share one encoded body.
+ */
+void GameServer::sendSnapshots()
+{
+  const Snapshot& snapshot = mHistory[mTick % Network::HistorySize];
+  bool isEncoded = false;
+  const Snapshot* encodedBaseline = nullptr;
+
+  for (Client& client : mClients)
+  {
+    const Snapshot* baseline = findBaseline(client);
+    if (!isEncoded || baseline != encodedBaseline)
+    {
+      mBody.clear();
+      snapshot.write(mBody, baseline);
+      isEncoded = true;
+      encodedBaseline = baseline;
+    }
+
+    if (mBody.getDataSize() > Network::MaxFragments * Network::FragmentSize)
+    {
+      ++mStatistics.oversized;
+      continue;
+    }
+
+    // Datagrams may get lost, the client keeps acknowledging older snapshots until one arrives. A snapshot the socket
+    // failed to send does not count as served.
+    if (!sendFragments(client, baseline ? baseline -> getTick() : Snapshot::NoTick))
+      continue;
+    client.isServed = true;
+    ++mStatistics.snapshots;
+    if (!baseline)
+      ++mStatistics.fullSnapshots;
+  }
+}
+
+/**
+ * Send the encoded body to one client, FragmentSize bytes per datagram. Each datagram repeats the ticks and tells
+ * which part of the body it carries, so the client can put the parts back together in any order.
+ * @param client a Client object indicates the receiver.
+ * @param baselineTick a 32-bit integer indicates the tick of the baseline the body was written against.
+ * @return a bool value indicates whether the socket sent every fragment.
+ */
+bool GameServer::sendFragments(const Client& client, std::uint32_t baselineTick)
+{
+  const char* data = static_cast<const char*>(mBody.getData());
+  const std::size_t size = mBody.getDataSize();
+  const std::size_t count = std::max<std::size_t>(1, (size + Network::FragmentSize - 1) / Network::FragmentSize);
+
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    const std::size_t offset = index * Network::FragmentSize;
+    mPacket.clear();
+    mPacket << static_cast<sf::Uint8>(Network::WorldState) << static_cast<sf::Uint32>(mTick)
+            << static_cast<sf::Uint32>(baselineTick) << static_cast<sf::Uint8>(index)
+            << static_cast<sf::Uint8>(count);
+    mPacket.append(data + offset, std::min(Network::FragmentSize, size - offset));
+    if (mSocket.send(mPacket, client.address, client.port) != sf::Socket::Done)
+    {
+      // The client cannot put the snapshot together without this fragment, the rest would be wasted.
+      return false;
+    }
+    mStatistics.bytesSent += mPacket.getDataSize();
+  }
+
+  if (count > 1)
+    ++mStatistics.fragmented;
+  return true;
+}
+
+/**
+ * Get the baseline a client has for the current tick: the latest snapshot it acknowledged, if still in the history.
+ * @param client a Client object indicates the client.
+ * @return a pointer to the baseline snapshot, nullptr if the client has none recent enough.
+ */
+const Snapshot* GameServer::findBaseline(const Client& client) const
+{
+  const std::uint32_t tick = client.acknowledgedTick;
+  if (tick == Snapshot::NoTick || mTick - tick >= Network::HistorySize)
+    return nullptr;
+
+  const Snapshot& baseline = mHistory[tick % Network::HistorySize];
+  return baseline.getTick() == tick ? &baseline : nullptr;
+}
+
+/**
+ * Get a connected client by its address.
+ * @param address a sf::IpAddress indicates the address of the client.
+ * @param port an unsigned short indicates the port of the client.
+ * @return a pointer to the client, nullptr if unknown.
+ */
+GameServer::Client* GameServer::findClient(const sf::IpAddress& address, unsigned short port)
+{
+  for (Client& client : mClients)
+  {
+    if (client.address == address && client.port == port)
+      return &client;
+  }
+  return nullptr;
+}
@@ -1,5 +1,25 @@
 // Include project header files
 #include "GameState.hpp"
+#include "AllocationTracker.hpp"
+#include "FrameGovernor.hpp"
+#include "Utility.hpp"
+
+// Include C++ standard headers.
+#include <iostream>
+#include <stdexcept>
+
+// File the game is quicksaved into(F5) and quickloaded from(F9).
+static const char* const QuicksaveFile = "quicksave.sav";
+
+#ifdef LOG_CHECKSUMS
+// File receiving the world checksum of every tick.
+static const char* const ChecksumLogFile = "checksums.log";
+#endif
+
+#ifdef ZERO_ALLOCATION_BUDGET
+// Number of ticks the game world may allocate freely before the zero allocation budget applies.
+static const std::size_t AllocationWarmUpTicks = 60;
+#endif
 
 /**
  * Constructor of GameState class.
@@ -8,8 +28,14 @@
  */
 GameState::GameState(StateStack& stack, Context context)
     : State(stack, context)
-    , mWorld(*context.window)
+    , mWorld(*context.window, *context.sounds)
     , mPlayer(*context.player)
+    , mTickCount(0)
+    , mQuicksave()
+    , mSaveWriter()
+#ifdef LOG_CHECKSUMS
+    , mChecksumLog(ChecksumLogFile)
+#endif
 {
 }
 
@@ -28,14 +54,55 @@ void GameState::draw()
  */
 bool GameState::update(sf::Time dt)
 {
+#ifdef ZERO_ALLOCATION_BUDGET
+  AllocationTracker::Counters before = AllocationTracker::getThreadCounters();
+#endif
+
+  // Leave out cosmetic work while the governor reports that updates eat most of the frame budget.
+  mWorld.setEffectsThrottled(getContext().governor -> isDegraded());
   mWorld.update(dt);
+  // The world scrolls every tick, so it always has to be drawn again.
+  markDirty();
+#ifdef LOG_CHECKSUMS
+  mChecksumLog.write(mTickCount, mWorld.computeChecksum());
+#endif
 
+  // The keys tapped in the menu before the round started are no input of it.
+  if (mTickCount == 0)
+    mPlayer.clearTaps();
   CommandQueue& commands = mWorld.getCommandQueue();
   mPlayer.handleRealtimeInput(commands);
 
+#ifdef ZERO_ALLOCATION_BUDGET
+  // Once warmed up, a running game world must not touch the heap at all.
+  std::size_t allocations = AllocationTracker::getThreadCounters().allocations - before.allocations;
+  if (mTickCount >= AllocationWarmUpTicks && allocations > 0)
+    throw std::runtime_error("GameState::update - " + toString(allocations) + " heap allocation(s) at tick "
+                             + toString(mTickCount) + " after warm-up");
+#endif
+  ++mTickCount;
+
   return true;
 }
 
+/**
+ * Start a new round when the cached game state is pushed again(textures stay loaded).
+ */
+void GameState::reset()
+{
+  mWorld.reset();
+  mTickCount = 0;
+}
+
+/**
+ * Hand the game world's textures over before the game state is destroyed.
+ * @param textures a vector receiving the unique_ptr of each texture.
+ */
+void GameState::releaseTextures(std::vector<std::unique_ptr<sf::Texture>>& textures)
+{
+  mWorld.releaseTextures(textures);
+}
+
 /**
  * Handle each event in the game command queue.
  * @param event a sf::Event object indicates an event.
@@ -51,5 +118,43 @@ bool GameState::handleEvent(const sf::Event& event)
   if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)
     requestStackPush(States::Pause);
 
+  // F5 saves the game, F9 loads the last save.
+  if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F5)
+    quicksave();
+  else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F9)
+    quickload();
+
   return true;
+}
+
+/**
+ * Save the game into the quicksave file. The world is copied into the save's buffer within the frame, the file is
+ * written on the writer's thread. A quicksave while the previous one is still being written is skipped.
+ */
+void GameState::quicksave()
+{
+  if (mSaveWriter.isWriting())
+    return;
+
+  mWorld.saveGame(mQuicksave);
+  mSaveWriter.write(mQuicksave, QuicksaveFile);
+}
+
+/**
+ * Replace the game by the quicksave file. A missing or broken file is reported and the game goes on(from the start
+ * of the round if the save did not fit the world).
+ */
+void GameState::quickload()
+{
+  try
+  {
+    SaveGame save;
+    save.loadFromFile(QuicksaveFile);
+    mWorld.loadGame(save);
+    markDirty();
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "\nEXCEPTION: " << e.what() << std::endl;
+  }
 }
\ No newline at end of file
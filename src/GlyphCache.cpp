@@ -0,0 +1,84 @@
+// Include project header files
+#include "GlyphCache.hpp"
+#include "ResourceHolder.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+// Every character from the space to the tilde.
+const std::string GlyphCache::PrintableCharacters = " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                                    "[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
+
+/**
+ * Constructor of GlyphCache class.
+ */
+GlyphCache::GlyphCache()
+    : mDeclared()
+    , mRasterized()
+    , mMissCount(0)
+{
+}
+
+/**
+ * Declare characters which are shown with a font at a character size, declaring a character twice is harmless.
+ * @param font an enum indicates the font the characters are shown with.
+ * @param characterSize an unsigned int indicates the character size they are shown at.
+ * @param characters a string indicates the characters.
+ */
+void GlyphCache::declare(Fonts::ID font, unsigned int characterSize, const std::string& characters)
+{
+  mDeclared[std::make_pair(font, characterSize)] += characters;
+}
+
+/**
+ * Rasterize every declared glyph into the font's glyph page. Fonts have to be loaded before.
+ * @param fonts a FontHolder object indicates the holder of all loaded fonts.
+ */
+void GlyphCache::warmUp(const FontHolder& fonts)
+{
+  for (const auto& declared : mDeclared)
+  {
+    const sf::Font& font = fonts.get(declared.first.first);
+    unsigned int characterSize = declared.first.second;
+
+    for (char character : declared.second)
+    {
+      sf::Uint32 codePoint = static_cast<unsigned char>(character);
+      // Asking for a glyph renders it into the glyph page of its character size.
+      font.getGlyph(codePoint, characterSize, false);
+      mRasterized.insert(std::make_tuple(&font, characterSize, codePoint));
+    }
+  }
+}
+
+/**
+ * Count the glyphs of a text which were not rasterized before as misses, call it whenever a text's string changes.
+ * Each glyph is only counted once, since sf::Font keeps it from then on.
+ * @param text a sf::Text object indicates the text which is going to be shown.
+ */
+void GlyphCache::check(const sf::Text& text)
+{
+  const sf::Font* font = text.getFont();
+  if (!font)
+    return;
+
+  for (sf::Uint32 codePoint : text.getString())
+  {
+    // Line breaks are never rendered.
+    if (codePoint == '\n')
+      continue;
+
+    if (mRasterized.insert(std::make_tuple(font, text.getCharacterSize(), codePoint)).second)
+      ++mMissCount;
+  }
+}
+
+/**
+ * Get the number of glyph cache misses so far.
+ * @return a std::size_t indicates how many glyphs were rasterized on first use instead of at load time.
+ */
+std::size_t GlyphCache::getMissCount() const
+{
+  return mMissCount;
+}
@@ -0,0 +1,97 @@
+// Include project header files
+#include "InputSampler.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/Sleep.hpp>
+
+// Sample the keys 1000 times per second.
+const sf::Time InputSampler::SampleInterval = sf::milliseconds(1);
+
+/**
+ * Default constructor of InputEvent struct.
+ */
+InputEvent::InputEvent()
+    : key(sf::Keyboard::Unknown)
+    , pressed(false)
+    , timestamp(sf::Time::Zero)
+{
+}
+
+/**
+ * Constructor of InputEvent struct.
+ * @param key a sf::Keyboard::Key indicates the key which changed.
+ * @param pressed a bool value indicates whether the key went down or up.
+ * @param timestamp a sf::Time indicates when the transition was sampled.
+ */
+InputEvent::InputEvent(sf::Keyboard::Key key, bool pressed, sf::Time timestamp)
+    : key(key)
+    , pressed(pressed)
+    , timestamp(timestamp)
+{
+}
+
+/**
+ * Constructor of InputSampler class, start sampling the given keys.
+ * @param keys a vector of sf::Keyboard::Key indicates which keys are sampled.
+ */
+InputSampler::InputSampler(const std::vector<sf::Keyboard::Key>& keys)
+    : mKeys(keys)
+    , mKeyStates(keys.size(), false)
+    , mClock()
+    , mQueue()
+    , mRunning(true)
+    , mThread(&InputSampler::run, this)
+{
+}
+
+/**
+ * Destructor of InputSampler class, stop the sampling thread.
+ */
+InputSampler::~InputSampler()
+{
+  mRunning = false;
+  mThread.join();
+}
+
+/**
+ * Pop the oldest sampled transition, must only be called from the main thread.
+ * @param input an InputEvent receiving the transition.
+ * @return a bool value indicates whether there was a transition.
+ */
+bool InputSampler::pollInput(InputEvent& input)
+{
+  return mQueue.pop(input);
+}
+
+/**
+ * Get the current time of the clock used for the timestamps, so that latencies can be measured against them.
+ * @return a sf::Time indicates the time since the sampler was created.
+ */
+sf::Time InputSampler::now() const
+{
+  return mClock.getElapsedTime();
+}
+
+/**
+ * Main loop of the sampling thread, sample every key and push each transition with its timestamp.
+ */
+void InputSampler::run()
+{
+  while (mRunning)
+  {
+    sf::Time timestamp = mClock.getElapsedTime();
+
+    for (std::size_t i = 0; i < mKeys.size(); ++i)
+    {
+      bool pressed = sf::Keyboard::isKeyPressed(mKeys[i]);
+      if (pressed == mKeyStates[i])
+        continue;
+
+      // If the main thread falls far behind the queue is full, we keep the old state and try again next sample.
+      if (mQueue.push(InputEvent(mKeys[i], pressed, timestamp)))
+        mKeyStates[i] = pressed;
+    }
+
+    sf::sleep(SampleInterval);
+  }
+}
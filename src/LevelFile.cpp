@@ -0,0 +1,373 @@
+// Include project header files
+#include "LevelFile.hpp"
+#include "Aircraft.hpp"
+#include "Utility.hpp"
+
+// Include C++ standard headers.
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+// Include platform headers for mapping files.
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+const std::uint32_t LevelFile::Magic;
+const std::uint32_t LevelFile::Version;
+const std::uint32_t LevelFile::NoFormation;
+
+namespace
+{
+  // Get the aircraft type a level source names, throws if there is none.
+  std::uint32_t parseAircraftType(const std::string& name, std::size_t line)
+  {
+    for (int type = 0; type < Aircraft::TypeCount; ++type)
+    {
+      if (name == AircraftData::Names[type])
+        return type;
+    }
+    throw std::runtime_error("LevelFile::compile - Unknown aircraft type " + name + " in line " + toString(line));
+  }
+
+  // Get the index of a formation a level source names, throws if it was not defined before.
+  std::uint32_t findFormation(const std::map<std::string, std::uint32_t>& formations, const std::string& name,
+                              std::size_t line)
+  {
+    std::map<std::string, std::uint32_t>::const_iterator found = formations.find(name);
+    if (found == formations.end())
+      throw std::runtime_error("LevelFile::compile - Unknown formation " + name + " in line " + toString(line));
+    return found -> second;
+  }
+}
+
+/**
+ * Constructor of LevelFile class, maps a level file and checks its header, formations and spawns: every spawn must
+ * name an existing type and formation and must not come before the spawn preceding it.
+ * @param filename a std::string indicates the path of the level file.
+ */
+LevelFile::LevelFile(const std::string& filename)
+    : mData(nullptr)
+    , mSize(0)
+    , mFormations(nullptr)
+    , mOffsets(nullptr)
+    , mSpawns(nullptr)
+{
+  map(filename);
+
+  try
+  {
+    if (mSize < sizeof(Header))
+      throw std::runtime_error("LevelFile::LevelFile - " + filename + " is too short for a level");
+
+    const Header& header = getHeader();
+    if (header.magic != Magic)
+      throw std::runtime_error("LevelFile::LevelFile - " + filename + " is no level");
+    if (header.version != Version)
+      throw std::runtime_error("LevelFile::LevelFile - " + filename + " has an unsupported version");
+    if (!std::memchr(header.backgroundTile, '\0', sizeof(header.backgroundTile)) ||
+        !(header.worldHeight > 0.f) || !std::isfinite(header.worldHeight) || !std::isfinite(header.scrollSpeed))
+      throw std::runtime_error("LevelFile::LevelFile - " + filename + " has a broken header");
+
+    // The records follow the header without padding, every one of them is made of 32-bit fields.
+    const std::uint64_t size = sizeof(Header) + std::uint64_t(header.formationCount) * sizeof(Formation) +
+                               std::uint64_t(header.offsetCount) * sizeof(Offset) +
+                               std::uint64_t(header.spawnCount) * sizeof(Spawn);
+    if (size != mSize)
+      throw std::runtime_error("LevelFile::LevelFile - " + filename + " does not match the size of its records");
+
+    mFormations = reinterpret_cast<const Formation*>(mData + sizeof(Header));
+    mOffsets = reinterpret_cast<const Offset*>(mFormations + header.formationCount);
+    mSpawns = reinterpret_cast<const Spawn*>(mOffsets + header.offsetCount);
+
+    for (std::size_t i = 0; i < header.formationCount; ++i)
+    {
+      if (std::uint64_t(mFormations[i].firstOffset) + mFormations[i].offsetCount > header.offsetCount)
+        throw std::runtime_error("LevelFile::LevelFile - " + filename + " has a formation past its offsets");
+    }
+    if (header.escortFormation != NoFormation &&
+        (header.escortFormation >= header.formationCount || header.escortType >= Aircraft::TypeCount))
+      throw std::runtime_error("LevelFile::LevelFile - " + filename + " has broken escorts");
+
+    for (std::size_t i = 0; i < header.spawnCount; ++i)
+    {
+      const Spawn& spawn = mSpawns[i];
+      if (spawn.type >= Aircraft::TypeCount || spawn.formation >= header.formationCount ||
+          !std::isfinite(spawn.distance) || !std::isfinite(spawn.x) ||
+          (i > 0 && spawn.distance < mSpawns[i - 1].distance))
+        throw std::runtime_error("LevelFile::LevelFile - " + filename + " has a broken spawn " + toString(i));
+    }
+  }
+  catch (...)
+  {
+    unmap();
+    throw;
+  }
+}
+
+/**
+ * Destructor of LevelFile class, unmaps the file.
+ */
+LevelFile::~LevelFile()
+{
+  unmap();
+}
+
+/**
+ * Get the header of the level.
+ * @return a Header object indicates the header.
+ */
+const LevelFile::Header& LevelFile::getHeader() const
+{
+  return *reinterpret_cast<const Header*>(mData);
+}
+
+/**
+ * Get the path of the image the background is tiled with.
+ * @return a std::string indicates the path.
+ */
+std::string LevelFile::getBackgroundTile() const
+{
+  return getHeader().backgroundTile;
+}
+
+/**
+ * Get a formation, which was checked at load.
+ * @param index a std::size_t indicates the index of the formation.
+ * @return a Formation object indicates the range of its offsets.
+ */
+const LevelFile::Formation& LevelFile::getFormation(std::size_t index) const
+{
+  assert(index < getHeader().formationCount);
+  return mFormations[index];
+}
+
+/**
+ * Get the offset of one aircraft of a formation.
+ * @param index a std::size_t indicates the index of the offset.
+ * @return an Offset object indicates the position relative to the formation's anchor.
+ */
+const LevelFile::Offset& LevelFile::getOffset(std::size_t index) const
+{
+  assert(index < getHeader().offsetCount);
+  return mOffsets[index];
+}
+
+/**
+ * Get the number of spawns of the level.
+ * @return a std::size_t indicates the number of spawns.
+ */
+std::size_t LevelFile::getSpawnCount() const
+{
+  return getHeader().spawnCount;
+}
+
+/**
+ * Get one spawn, which was checked at load.
+ * @param index a std::size_t indicates the index of the spawn.
+ * @return a Spawn object indicates the spawn.
+ */
+const LevelFile::Spawn& LevelFile::getSpawn(std::size_t index) const
+{
+  assert(index < getSpawnCount());
+  return mSpawns[index];
+}
+
+/**
+ * Compile a text description of a level into a level file. Each line of the source holds one statement, blank
+ * lines and lines starting with '#' are skipped:
+ *   background <path>                          the image the background is tiled with
+ *   height <units>                             height of the world
+ *   scroll <speed>                             speed with which the view scrolls upward
+ *   formation <name>                           start a formation, its offsets follow
+ *   offset <x> <y>                             add an aircraft to the last formation
+ *   escorts <type> <formation>                 escorts of a single player, relative to the player
+ *   spawn <distance> <x> <type> <formation>    enemies ahead of the player's spawn position
+ * Formations must be defined before they are used. Spawns may come in any order, they are sorted by distance.
+ * @param source a std::string indicates the path of the text description.
+ * @param destination a std::string indicates the path of the level file written.
+ */
+void LevelFile::compile(const std::string& source, const std::string& destination)
+{
+  std::ifstream in(source.c_str());
+  if (!in)
+    throw std::runtime_error("LevelFile::compile - Failed to open " + source);
+
+  Header header;
+  std::memset(&header, 0, sizeof(header));
+  header.magic = Magic;
+  header.version = Version;
+  header.escortFormation = NoFormation;
+
+  std::vector<Formation> formations;
+  std::vector<Offset> offsets;
+  std::vector<Spawn> spawns;
+  std::map<std::string, std::uint32_t> formationIndices;
+
+  std::string text;
+  for (std::size_t line = 1; std::getline(in, text); ++line)
+  {
+    std::istringstream statement(text);
+    std::string keyword;
+    if (!(statement >> keyword) || keyword[0] == '#')
+      continue;
+
+    bool isValid = true;
+    if (keyword == "background")
+    {
+      std::string path;
+      isValid = static_cast<bool>(statement >> path) && path.size() < sizeof(header.backgroundTile);
+      if (isValid)
+        std::strcpy(header.backgroundTile, path.c_str());
+    }
+    else if (keyword == "height")
+      isValid = static_cast<bool>(statement >> header.worldHeight) && header.worldHeight > 0.f;
+    else if (keyword == "scroll")
+      isValid = static_cast<bool>(statement >> header.scrollSpeed);
+    else if (keyword == "formation")
+    {
+      std::string name;
+      isValid = static_cast<bool>(statement >> name) && formationIndices.count(name) == 0;
+      if (isValid)
+      {
+        formationIndices[name] = static_cast<std::uint32_t>(formations.size());
+        Formation formation = { static_cast<std::uint32_t>(offsets.size()), 0 };
+        formations.push_back(formation);
+      }
+    }
+    else if (keyword == "offset")
+    {
+      Offset offset;
+      isValid = static_cast<bool>(statement >> offset.x >> offset.y) && !formations.empty();
+      if (isValid)
+      {
+        offsets.push_back(offset);
+        ++formations.back().offsetCount;
+      }
+    }
+    else if (keyword == "escorts")
+    {
+      std::string type, formation;
+      isValid = static_cast<bool>(statement >> type >> formation);
+      if (isValid)
+      {
+        header.escortType = parseAircraftType(type, line);
+        header.escortFormation = findFormation(formationIndices, formation, line);
+      }
+    }
+    else if (keyword == "spawn")
+    {
+      Spawn spawn;
+      std::string type, formation;
+      isValid = static_cast<bool>(statement >> spawn.distance >> spawn.x >> type >> formation);
+      if (isValid)
+      {
+        spawn.type = parseAircraftType(type, line);
+        spawn.formation = findFormation(formationIndices, formation, line);
+        spawns.push_back(spawn);
+      }
+    }
+    else
+      isValid = false;
+
+    std::string rest;
+    if (!isValid || statement >> rest)
+      throw std::runtime_error("LevelFile::compile - Invalid statement in line " + toString(line) + " of " + source);
+  }
+
+  if (header.backgroundTile[0] == '\0' || !(header.worldHeight > 0.f))
+    throw std::runtime_error("LevelFile::compile - " + source + " lacks a background or a height");
+
+  // The world reads the spawns front to back as the view scrolls, spawns at the same distance keep their order.
+  std::stable_sort(spawns.begin(), spawns.end(), [] (const Spawn& lhs, const Spawn& rhs)
+  { return lhs.distance < rhs.distance; });
+
+  header.formationCount = static_cast<std::uint32_t>(formations.size());
+  header.offsetCount = static_cast<std::uint32_t>(offsets.size());
+  header.spawnCount = static_cast<std::uint32_t>(spawns.size());
+  for (const Spawn& spawn : spawns)
+    header.enemyCount += formations[spawn.formation].offsetCount;
+
+  std::ofstream out(destination.c_str(), std::ios::binary);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  if (!formations.empty())
+    out.write(reinterpret_cast<const char*>(formations.data()), formations.size() * sizeof(Formation));
+  if (!offsets.empty())
+    out.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(Offset));
+  if (!spawns.empty())
+    out.write(reinterpret_cast<const char*>(spawns.data()), spawns.size() * sizeof(Spawn));
+  if (!out.flush())
+    throw std::runtime_error("LevelFile::compile - Failed to write " + destination);
+}
+
+/**
+ * Map the whole file read-only. The mapping outlives the file handle, which is closed at once.
+ * @param filename a std::string indicates the path of the file.
+ */
+void LevelFile::map(const std::string& filename)
+{
+#ifdef _WIN32
+  HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    throw std::runtime_error("LevelFile::map - Failed to open " + filename);
+
+  LARGE_INTEGER size;
+  HANDLE mapping = nullptr;
+  if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (!mapping)
+    throw std::runtime_error("LevelFile::map - Failed to map " + filename);
+
+  const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (!data)
+    throw std::runtime_error("LevelFile::map - Failed to map " + filename);
+  mData = static_cast<const char*>(data);
+  mSize = static_cast<std::size_t>(size.QuadPart);
+#else
+  const int file = open(filename.c_str(), O_RDONLY);
+  if (file < 0)
+    throw std::runtime_error("LevelFile::map - Failed to open " + filename);
+
+  struct stat status;
+  void* data = MAP_FAILED;
+  if (fstat(file, &status) == 0 && status.st_size > 0)
+    data = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+  close(file);
+  if (data == MAP_FAILED)
+    throw std::runtime_error("LevelFile::map - Failed to map " + filename);
+  mData = static_cast<const char*>(data);
+  mSize = static_cast<std::size_t>(status.st_size);
+#endif
+}
+
+/**
+ * Unmap the file.
+ */
+void LevelFile::unmap()
+{
+  if (!mData)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(mData);
+#else
+  munmap(const_cast<char*>(mData), mSize);
+#endif
+  mData = nullptr;
+  mSize = 0;
+}
@@ -2,11 +2,28 @@
 #include "MenuState.hpp"
 #include "Utility.hpp"
 #include "ResourceHolder.hpp"
+#include "GlyphCache.hpp"
 
 // Include our Third-Party SFML header
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/View.hpp>
 
+// Strings of the menu options.
+static const char* const PlayString = "Play";
+static const char* const ExitString = "Exit";
+// Character size of the menu options(sf::Text's default).
+static const unsigned int OptionSize = 30;
+
+/**
+ * Declare the glyphs the menu shows, so that they are rasterized at load time.
+ * @param glyphs a GlyphCache object collecting the declarations.
+ */
+void MenuState::declareGlyphs(GlyphCache& glyphs)
+{
+  glyphs.declare(Fonts::Main, OptionSize, PlayString);
+  glyphs.declare(Fonts::Main, OptionSize, ExitString);
+}
+
 /**
  *
  * @param stack
@@ -29,7 +46,9 @@ MenuState::MenuState(StateStack& stack, Context context)
   // All settings for play option.
   sf::Text playOption;
   playOption.setFont(font);
-  playOption.setString("Play");
+  playOption.setString(PlayString);
+  playOption.setCharacterSize(OptionSize);
+  context.glyphs -> check(playOption);
   centerOrigin(playOption);
   playOption.setPosition(context.window -> getView().getSize() / 2.f);
   mOptions.push_back(playOption);
@@ -37,12 +56,16 @@ MenuState::MenuState(StateStack& stack, Context context)
   // All settings for exit option.
   sf::Text exitOption;
   exitOption.setFont(font);
-  exitOption.setString("Exit");
+  exitOption.setString(ExitString);
+  exitOption.setCharacterSize(OptionSize);
+  context.glyphs -> check(exitOption);
   centerOrigin(exitOption);
   exitOption.setPosition(playOption.getPosition() + sf::Vector2f(0.f, 30.f));
   mOptions.push_back(exitOption);
   // Present visual effects on all option text under menu state.
   updateOptionText();
+  // Playing is the most likely choice, so construct the game state in the background already.
+  requestStatePrewarm(States::Game);
 }
 
 /**
@@ -125,6 +148,16 @@ bool MenuState::handleEvent(const sf::Event& event)
   return true;
 }
 
+/**
+ * Select the first option again and pre-warm the game state when the cached menu state is pushed again.
+ */
+void MenuState::reset()
+{
+  mOptionIndex = 0;
+  updateOptionText();
+  requestStatePrewarm(States::Game);
+}
+
 /**
  * Present visual effects on all option text under menu state.
  * Only the selected option is highlighted in red, and the remaining is in white.
@@ -140,4 +173,6 @@ void MenuState::updateOptionText()
 
   // Red the selected text
   mOptions[mOptionIndex].setColor(sf::Color::Red);
+  // The highlighted option is the only change of the menu.
+  markDirty();
 }
\ No newline at end of file
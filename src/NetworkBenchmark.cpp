@@ -0,0 +1,73 @@
+// Include project header files
+#include "NetworkBenchmark.hpp"
+#include "GameServer.hpp"
+#include "NetworkClient.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/Clock.hpp>
+
+// Include C++ standard headers.
+#include <memory>
+#include <vector>
+
+namespace
+{
+  // Ticks run before measuring, enough for every client to connect and the enemies to start firing.
+  const std::size_t WarmUpTicks = 300;
+  // Ticks measured(one minute of game time).
+  const std::size_t MeasuredTicks = 3600;
+}
+
+/**
+ * Measure the server with 1, 10 and 100 clients and write the results.
+ * @param out a std::ostream object indicates where the results are written to.
+ */
+void NetworkBenchmark::run(std::ostream& out)
+{
+  const std::size_t clientCounts[] = { 1, 10, 100 };
+  for (std::size_t clientCount : clientCounts)
+    measure(clientCount, out);
+}
+
+/**
+ * Measure one server with simulated clients on the same thread, all over loopback. The server ticks as fast as it
+ * can, and after each tick every client reads and acknowledges its snapshot. Only the time spent in the server is
+ * measured; the bandwidth is given at the game's rate of 60 ticks per second.
+ * @param clientCount a std::size_t indicates the number of clients.
+ * @param out a std::ostream object indicates where the result is written to.
+ */
+void NetworkBenchmark::measure(std::size_t clientCount, std::ostream& out)
+{
+  GameServer server(0);
+  std::vector<std::unique_ptr<NetworkClient>> clients;
+  for (std::size_t i = 0; i < clientCount; ++i)
+    clients.push_back(std::unique_ptr<NetworkClient>(new NetworkClient(sf::IpAddress::LocalHost, server.getPort())));
+
+  for (std::size_t i = 0; i < WarmUpTicks; ++i)
+  {
+    server.tick();
+    for (std::unique_ptr<NetworkClient>& client : clients)
+      client -> receive();
+  }
+
+  const GameServer::Statistics before = server.getStatistics();
+  sf::Time serverTime = sf::Time::Zero;
+  for (std::size_t i = 0; i < MeasuredTicks; ++i)
+  {
+    sf::Clock clock;
+    server.tick();
+    serverTime += clock.getElapsedTime();
+    for (std::unique_ptr<NetworkClient>& client : clients)
+      client -> receive();
+  }
+  const GameServer::Statistics& after = server.getStatistics();
+
+  const float seconds = serverTime.asSeconds();
+  const std::size_t snapshots = after.snapshots - before.snapshots;
+  const double bytes = static_cast<double>(after.bytesSent - before.bytesSent);
+  const float gameSeconds = MeasuredTicks * Network::TimePerTick.asSeconds();
+  out << clientCount << " client(s): " << server.getClientCount() << " connected, " << MeasuredTicks / seconds
+      << " server ticks/sec, " << (snapshots == 0 ? 0. : bytes / snapshots) << " bytes/snapshot, "
+      << bytes / clientCount / gameSeconds / 1024. << " KiB/sec per client, "
+      << after.fullSnapshots - before.fullSnapshots << " full snapshot(s)" << std::endl;
+}
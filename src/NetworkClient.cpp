@@ -0,0 +1,204 @@
+// Include project header files
+#include "NetworkClient.hpp"
+
+// Include C++ standard headers.
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+  // The connection is requested again after this long without a snapshot(the first datagram may get lost).
+  const sf::Time ConnectInterval = sf::seconds(1.f);
+}
+
+/**
+ * Constructor of NetworkClient class, binds any free port and asks the server to connect.
+ * @param server a sf::IpAddress indicates the address of the server.
+ * @param port an unsigned short indicates the port of the server.
+ */
+NetworkClient::NetworkClient(const sf::IpAddress& server, unsigned short port)
+    : mServer(server)
+    , mServerPort(port)
+    , mSocket()
+    , mHistory()
+    , mLatestTick(Snapshot::NoTick)
+    , mConnectClock()
+    , mPacket()
+    , mBody()
+    , mFragmentTick(Snapshot::NoTick)
+    , mFragmentBaselineTick(Snapshot::NoTick)
+    , mFragmentCount(0)
+    , mFragmentsReceived(0)
+    , mHasFragment(Network::MaxFragments, false)
+    , mFragmentData()
+    , mFragmentDataSize(0)
+    , mBytesReceived(0)
+{
+  if (mSocket.bind(sf::Socket::AnyPort) != sf::Socket::Done)
+    throw std::runtime_error("NetworkClient::NetworkClient - Failed to bind a port");
+  mSocket.setBlocking(false);
+
+  send(Network::Connect);
+}
+
+/**
+ * Destructor of NetworkClient class, tells the server that the client leaves(otherwise it times out).
+ */
+NetworkClient::~NetworkClient()
+{
+  send(Network::Disconnect);
+}
+
+/**
+ * Read every datagram waiting on the socket. Each snapshot is decoded against the baseline the server used and
+ * acknowledged, snapshots older than the latest one are ignored. A snapshot sent in one datagram is decoded at once,
+ * one split into several once all of its fragments arrived.
+ * @return a bool value indicates whether a newer snapshot arrived.
+ */
+bool NetworkClient::receive()
+{
+  bool hasNewSnapshot = false;
+  sf::IpAddress address;
+  unsigned short port;
+  while (mSocket.receive(mPacket, address, port) == sf::Socket::Done)
+  {
+    if (address != mServer || port != mServerPort)
+      continue;
+    mBytesReceived += mPacket.getDataSize();
+
+    sf::Uint8 message, index, count;
+    sf::Uint32 tick, baselineTick;
+    if (!(mPacket >> message >> tick >> baselineTick >> index >> count) || message != Network::WorldState
+        || tick == Snapshot::NoTick || index >= count)
+      continue;
+    if (mLatestTick != Snapshot::NoTick && tick <= mLatestTick)
+      continue;
+
+    if (count == 1)
+      hasNewSnapshot = readSnapshot(mPacket, tick, baselineTick) || hasNewSnapshot;
+    else if (addFragment(tick, baselineTick, index, count))
+      hasNewSnapshot = readSnapshot(mBody, tick, baselineTick) || hasNewSnapshot;
+  }
+
+  if (mLatestTick == Snapshot::NoTick && mConnectClock.getElapsedTime() >= ConnectInterval)
+  {
+    send(Network::Connect);
+    mConnectClock.restart();
+  }
+  return hasNewSnapshot;
+}
+
+/**
+ * Get the latest snapshot.
+ * @return a pointer to the snapshot, nullptr until the first one arrived.
+ */
+const Snapshot* NetworkClient::getSnapshot() const
+{
+  if (mLatestTick == Snapshot::NoTick)
+    return nullptr;
+  return &mHistory[mLatestTick % Network::HistorySize];
+}
+
+/**
+ * Get the number of bytes received so far.
+ * @return a 64-bit integer indicates the number of bytes.
+ */
+std::uint64_t NetworkClient::getBytesReceived() const
+{
+  return mBytesReceived;
+}
+
+/**
+ * Add the fragment in mPacket to the snapshot being reassembled. A fragment of a newer snapshot drops the one being
+ * reassembled(the server sends a newer snapshot every tick, an incomplete one would never be read anyway).
+ * @param tick a 32-bit integer indicates the tick of the snapshot.
+ * @param baselineTick a 32-bit integer indicates the tick of the baseline the snapshot was written against.
+ * @param index a std::size_t indicates which part of the body the fragment carries.
+ * @param count a std::size_t indicates the number of fragments of the snapshot.
+ * @return a bool value indicates whether every fragment arrived, the body is in mBody then.
+ */
+bool NetworkClient::addFragment(std::uint32_t tick, std::uint32_t baselineTick, std::size_t index, std::size_t count)
+{
+  if (mFragmentTick == Snapshot::NoTick || tick > mFragmentTick)
+  {
+    mFragmentTick = tick;
+    mFragmentBaselineTick = baselineTick;
+    mFragmentCount = count;
+    mFragmentsReceived = 0;
+    mFragmentDataSize = 0;
+    std::fill(mHasFragment.begin(), mHasFragment.end(), false);
+  }
+  else if (tick != mFragmentTick || baselineTick != mFragmentBaselineTick || count != mFragmentCount)
+  {
+    return false;
+  }
+
+  // Every fragment but the last one carries exactly FragmentSize bytes.
+  const std::size_t size = mPacket.getDataSize() - Network::WorldStateHeaderSize;
+  if (mHasFragment[index] || size > Network::FragmentSize || (index + 1 < count && size != Network::FragmentSize))
+    return false;
+
+  const std::size_t offset = index * Network::FragmentSize;
+  if (mFragmentData.size() < offset + size)
+    mFragmentData.resize(offset + size);
+  const char* data = static_cast<const char*>(mPacket.getData()) + Network::WorldStateHeaderSize;
+  std::copy(data, data + size, mFragmentData.begin() + offset);
+  if (index + 1 == count)
+    mFragmentDataSize = offset + size;
+  mHasFragment[index] = true;
+
+  if (++mFragmentsReceived < mFragmentCount)
+    return false;
+
+  mBody.clear();
+  mBody.append(mFragmentData.data(), mFragmentDataSize);
+  mFragmentTick = Snapshot::NoTick;
+  return true;
+}
+
+/**
+ * Decode a snapshot body against the baseline the server used and acknowledge it.
+ * @param body a sf::Packet object indicates the body, read from its current position.
+ * @param tick a 32-bit integer indicates the tick of the snapshot.
+ * @param baselineTick a 32-bit integer indicates the tick of the baseline the snapshot was written against.
+ * @return a bool value indicates whether the snapshot was read and became the latest one.
+ */
+bool NetworkClient::readSnapshot(sf::Packet& body, std::uint32_t tick, std::uint32_t baselineTick)
+{
+  // Without the baseline(too old, or never received) the snapshot cannot be decoded.
+  const Snapshot* baseline = nullptr;
+  if (baselineTick != Snapshot::NoTick)
+  {
+    baseline = &mHistory[baselineTick % Network::HistorySize];
+    if (baseline -> getTick() != baselineTick || baselineTick % Network::HistorySize == tick % Network::HistorySize)
+      return false;
+  }
+
+  Snapshot& snapshot = mHistory[tick % Network::HistorySize];
+  if (!snapshot.read(body, baseline))
+  {
+    // The slot may have held the latest snapshot, which is gone now.
+    if (mLatestTick % Network::HistorySize == tick % Network::HistorySize)
+      mLatestTick = Snapshot::NoTick;
+    snapshot.setTick(Snapshot::NoTick);
+    return false;
+  }
+  snapshot.setTick(tick);
+  mLatestTick = tick;
+
+  mPacket.clear();
+  mPacket << static_cast<sf::Uint8>(Network::Acknowledge) << static_cast<sf::Uint32>(tick);
+  mSocket.send(mPacket, mServer, mServerPort);
+  return true;
+}
+
+/**
+ * Send a message without payload to the server.
+ * @param message a Network::Message indicates the type of the datagram.
+ */
+void NetworkClient::send(Network::Message message)
+{
+  mPacket.clear();
+  mPacket << static_cast<sf::Uint8>(message);
+  mSocket.send(mPacket, mServer, mServerPort);
+}
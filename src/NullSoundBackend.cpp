@@ -0,0 +1,66 @@
+// Include project header files
+#include "NullSoundBackend.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Audio/SoundBuffer.hpp>
+
+// Include C++ standard headers.
+#include <cassert>
+
+/**
+ * Constructor of NullSoundBackend class.
+ * @param voiceCount a std::size_t indicates how many sounds can play at the same time.
+ */
+NullSoundBackend::NullSoundBackend(std::size_t voiceCount)
+    : mClock()
+    , mEndTimes(voiceCount, sf::Time::Zero)
+{
+}
+
+/**
+ * Get the number of voices.
+ * @return a std::size_t indicates how many sounds can play at the same time.
+ */
+std::size_t NullSoundBackend::getVoiceCount() const
+{
+  return mEndTimes.size();
+}
+
+/**
+ * Pretend to play a sound buffer on a voice, the voice stays busy for the buffer's duration.
+ * @param voice a std::size_t indicates the index of the voice.
+ * @param buffer a sf::SoundBuffer object indicates the samples to play.
+ */
+void NullSoundBackend::play(std::size_t voice, const sf::SoundBuffer& buffer, sf::Vector2f)
+{
+  assert(voice < mEndTimes.size());
+  mEndTimes[voice] = mClock.getElapsedTime() + buffer.getDuration();
+}
+
+/**
+ * Stop a voice.
+ * @param voice a std::size_t indicates the index of the voice.
+ */
+void NullSoundBackend::stop(std::size_t voice)
+{
+  assert(voice < mEndTimes.size());
+  mEndTimes[voice] = sf::Time::Zero;
+}
+
+/**
+ * Check whether a voice is still playing.
+ * @param voice a std::size_t indicates the index of the voice.
+ * @return a bool value indicates whether the voice is busy.
+ */
+bool NullSoundBackend::isPlaying(std::size_t voice) const
+{
+  assert(voice < mEndTimes.size());
+  return mClock.getElapsedTime() < mEndTimes[voice];
+}
+
+/**
+ * Ignore the listener position, there is nothing to hear.
+ */
+void NullSoundBackend::setListenerPosition(sf::Vector2f)
+{
+}
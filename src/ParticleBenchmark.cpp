@@ -0,0 +1,62 @@
+// Include project header files
+#include "ParticleBenchmark.hpp"
+#include "ParticleSystem.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/System/Clock.hpp>
+
+// Include C++ standard headers.
+#include <random>
+
+namespace
+{
+  // Every particle count is measured for at least this long and at least MinUpdates times.
+  const sf::Time MinDuration = sf::seconds(1.f);
+  const std::size_t MinUpdates = 60;
+  const sf::Time TimePerUpdate = sf::seconds(1.f / 60.f);
+  // Fastest speed of the particles along each axis.
+  const float ParticleSpeed = 120.f;
+}
+
+/**
+ * Measure the update with 32k, 64k and 128k live particles and write the results.
+ * @param out a std::ostream object indicates where the results are written to.
+ */
+void ParticleBenchmark::run(std::ostream& out)
+{
+  const std::size_t particleCounts[] = { 32768, 65536, 131072 };
+  for (std::size_t particleCount : particleCounts)
+    measure(particleCount, out);
+}
+
+/**
+ * Measure the update of a full explosion pool and write the result. The pool is filled again before each update,
+ * so every update handles the same number of live particles.
+ * @param particleCount a std::size_t indicates the number of live particles.
+ * @param out a std::ostream object indicates where the result is written to.
+ */
+void ParticleBenchmark::measure(std::size_t particleCount, std::ostream& out)
+{
+  ParticleSystem particles(ParticleSystem::Explosion, particleCount);
+  std::mt19937 random(42);
+  std::uniform_real_distribution<float> positionDistribution(0.f, 640.f);
+  std::uniform_real_distribution<float> speedDistribution(-ParticleSpeed, ParticleSpeed);
+
+  std::size_t updates = 0;
+  sf::Time elapsed = sf::Time::Zero;
+  while (updates < MinUpdates || elapsed < MinDuration)
+  {
+    particles.clear();
+    for (std::size_t i = 0; i < particleCount; ++i)
+      particles.spawn(sf::Vector2f(positionDistribution(random), positionDistribution(random)),
+                      sf::Vector2f(speedDistribution(random), speedDistribution(random)));
+
+    sf::Clock clock;
+    particles.update(TimePerUpdate);
+    elapsed += clock.getElapsedTime();
+    ++updates;
+  }
+
+  out << particleCount << " particles: " << elapsed.asMicroseconds() / updates << " us per update, "
+      << elapsed.asMicroseconds() * 1000.0 / (updates * particleCount) << " ns per particle" << std::endl;
+}
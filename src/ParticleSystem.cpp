@@ -0,0 +1,223 @@
+// Include project header files
+#include "ParticleSystem.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Graphics/RenderTarget.hpp>
+
+// Include C++ standard headers.
+#include <cassert>
+
+namespace
+{
+  // A struct indicates how the particles of one type look and how long they live.
+  struct ParticleData
+  {
+    sf::Color	color;
+    float		lifetime;
+    // Half the edge length of the quad when the particle is spawned and when it expires.
+    float		startHalfSize;
+    float		endHalfSize;
+  };
+
+  // Look of each particle type, indexed by ParticleSystem::Type.
+  const ParticleData Table[ParticleSystem::TypeCount] =
+  {
+    // Exhaust grows into fading smoke.
+    { sf::Color(255, 255, 160), 0.6f, 2.f, 6.f },
+    // Explosion sparks shrink while they fade.
+    { sf::Color(255, 140, 40), 0.8f, 4.f, 1.f },
+  };
+}
+
+/**
+ * Constructor of ParticleSystem class, allocate the whole pool so that spawning never allocates.
+ * @param type an enum indicates the type of particles held.
+ * @param capacity a std::size_t indicates the maximum number of live particles.
+ */
+ParticleSystem::ParticleSystem(Type type, std::size_t capacity)
+    : mType(type)
+    , mPositionsX(capacity)
+    , mPositionsY(capacity)
+    , mVelocitiesX(capacity)
+    , mVelocitiesY(capacity)
+    , mAges(capacity)
+    , mVertices(capacity * 4)
+    , mCount(0)
+    , mIsEmitting(true)
+    , mUpdateInterval(1)
+    , mSkippedUpdates(0)
+    , mSkippedTime(sf::Time::Zero)
+{
+  assert(type < TypeCount);
+}
+
+/**
+ * Add one particle.
+ * @param position a sf::Vector2f indicates the world position of the particle.
+ * @param velocity a sf::Vector2f indicates the velocity of the particle.
+ * @return a bool value indicates whether the particle was added(false if the pool is full).
+ */
+bool ParticleSystem::spawn(sf::Vector2f position, sf::Vector2f velocity)
+{
+  if (mCount == mAges.size() || !mIsEmitting)
+    return false;
+
+  mPositionsX[mCount] = position.x;
+  mPositionsY[mCount] = position.y;
+  mVelocitiesX[mCount] = velocity.x;
+  mVelocitiesY[mCount] = velocity.y;
+  mAges[mCount] = 0.f;
+  writeQuad(mCount);
+  ++mCount;
+  return true;
+}
+
+/**
+ * Remove every particle.
+ */
+void ParticleSystem::clear()
+{
+  mCount = 0;
+}
+
+/**
+ * Switch spawning on or off. It is off while ticks which were already shown are simulated again, so that their
+ * particles are not spawned twice.
+ * @param isEmitting a bool value indicates whether new particles are spawned.
+ */
+void ParticleSystem::setEmitting(bool isEmitting)
+{
+  mIsEmitting = isEmitting;
+}
+
+/**
+ * Integrate the particles only every interval-th update. The skipped updates are made up for by the next one, so the
+ * particles still live as long, they only move in coarser steps.
+ * @param interval a std::size_t indicates every how many updates the particles are integrated(at least 1).
+ */
+void ParticleSystem::setUpdateInterval(std::size_t interval)
+{
+  assert(interval > 0);
+  mUpdateInterval = interval;
+}
+
+/**
+ * Get the type of particles held.
+ * @return an enum indicates the type of particles.
+ */
+ParticleSystem::Type ParticleSystem::getType() const
+{
+  return mType;
+}
+
+/**
+ * Get the number of live particles.
+ * @return a std::size_t indicates the number of live particles.
+ */
+std::size_t ParticleSystem::getCount() const
+{
+  return mCount;
+}
+
+/**
+ * Get the maximum number of live particles.
+ * @return a std::size_t indicates the capacity of the pool.
+ */
+std::size_t ParticleSystem::getCapacity() const
+{
+  return mAges.size();
+}
+
+/**
+ * Integrate all particles, remove the expired ones and write the quads of the others. Each field is integrated in
+ * its own loop over a plain float array without branches, which lets the compiler vectorize it.
+ * @param dt a sf::Time object indicates the current frame time.
+ */
+void ParticleSystem::updateCurrent(sf::Time dt)
+{
+  mSkippedTime += dt;
+  if (++mSkippedUpdates < mUpdateInterval)
+    return;
+
+  const float seconds = mSkippedTime.asSeconds();
+  mSkippedUpdates = 0;
+  mSkippedTime = sf::Time::Zero;
+  const std::size_t count = mCount;
+
+  float* positionsX = mPositionsX.data();
+  float* positionsY = mPositionsY.data();
+  const float* velocitiesX = mVelocitiesX.data();
+  const float* velocitiesY = mVelocitiesY.data();
+  float* ages = mAges.data();
+
+  for (std::size_t i = 0; i < count; ++i)
+    positionsX[i] += velocitiesX[i] * seconds;
+  for (std::size_t i = 0; i < count; ++i)
+    positionsY[i] += velocitiesY[i] * seconds;
+  for (std::size_t i = 0; i < count; ++i)
+    ages[i] += seconds;
+
+  const float lifetime = Table[mType].lifetime;
+  for (std::size_t i = 0; i < mCount;)
+  {
+    if (mAges[i] >= lifetime)
+    {
+      // The last particle moves into slot i, which is checked again.
+      remove(i);
+      continue;
+    }
+
+    writeQuad(i);
+    ++i;
+  }
+}
+
+/**
+ * Draw all particles with one draw call.
+ * @param target indicates the sf::RenderTarget object we want to draw to
+ * @param states indicates the render states of the parent node
+ */
+void ParticleSystem::drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const
+{
+  if (mCount > 0)
+    target.draw(&mVertices[0], mCount * 4, sf::Quads, states);
+}
+
+/**
+ * Move the last particle into a slot, which removes the particle in that slot.
+ * @param index a std::size_t indicates the slot of the particle to remove.
+ */
+void ParticleSystem::remove(std::size_t index)
+{
+  assert(index < mCount);
+
+  --mCount;
+  mPositionsX[index] = mPositionsX[mCount];
+  mPositionsY[index] = mPositionsY[mCount];
+  mVelocitiesX[index] = mVelocitiesX[mCount];
+  mVelocitiesY[index] = mVelocitiesY[mCount];
+  mAges[index] = mAges[mCount];
+}
+
+/**
+ * Write the quad of one particle into the vertex array, its size and opacity follow its age.
+ * @param index a std::size_t indicates the slot of the particle.
+ */
+void ParticleSystem::writeQuad(std::size_t index)
+{
+  const ParticleData& data = Table[mType];
+  const float ratio = mAges[index] / data.lifetime;
+  const float halfSize = data.startHalfSize + (data.endHalfSize - data.startHalfSize) * ratio;
+  const float x = mPositionsX[index];
+  const float y = mPositionsY[index];
+
+  sf::Color color = data.color;
+  color.a = static_cast<sf::Uint8>(255.f * (1.f - ratio));
+
+  sf::Vertex* quad = &mVertices[index * 4];
+  quad[0].position = sf::Vector2f(x - halfSize, y - halfSize);
+  quad[1].position = sf::Vector2f(x + halfSize, y - halfSize);
+  quad[2].position = sf::Vector2f(x + halfSize, y + halfSize);
+  quad[3].position = sf::Vector2f(x - halfSize, y + halfSize);
+  quad[0].color = quad[1].color = quad[2].color = quad[3].color = color;
+}
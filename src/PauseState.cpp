@@ -2,11 +2,29 @@
 #include "PauseState.hpp"
 #include "Utility.hpp"
 #include "ResourceHolder.hpp"
+#include "GlyphCache.hpp"
+#include "Player.hpp"
 
 // Include our Third-Party SFML header
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 
+// Strings and character sizes of the pause screen.
+static const char* const PausedString = "Game Paused";
+static const unsigned int PausedSize = 70;
+static const char* const InstructionString = "(Press Backspace to return to the main menu)";
+static const unsigned int InstructionSize = 30;
+
+/**
+ * Declare the glyphs the pause screen shows, so that they are rasterized at load time.
+ * @param glyphs a GlyphCache object collecting the declarations.
+ */
+void PauseState::declareGlyphs(GlyphCache& glyphs)
+{
+  glyphs.declare(Fonts::Main, PausedSize, PausedString);
+  glyphs.declare(Fonts::Main, InstructionSize, InstructionString);
+}
+
 /**
  * Constructor of PauseState class.
  * @param stack a StateStack object indicates the game stack.
@@ -15,6 +33,7 @@
 PauseState::PauseState(StateStack& stack, Context context)
     : State(stack, context)
     , mBackgroundSprite()
+    , mBackgroundShape()
     , mPausedText()
     , mInstructionText()
 {
@@ -25,9 +44,10 @@ PauseState::PauseState(StateStack& stack, Context context)
   // Set the pause text font.
   mPausedText.setFont(font);
   // Set the pause string.
-  mPausedText.setString("Game Paused");
+  mPausedText.setString(PausedString);
   // Set the pause string size.
-  mPausedText.setCharacterSize(70);
+  mPausedText.setCharacterSize(PausedSize);
+  context.glyphs -> check(mPausedText);
   // Set pause text's origin to be its center position.
   centerOrigin(mPausedText);
   // Set the pause string position.
@@ -35,10 +55,16 @@ PauseState::PauseState(StateStack& stack, Context context)
   // Set the instruction text font.
   mInstructionText.setFont(font);
   // Set the instruction text string.
-  mInstructionText.setString("(Press Backspace to return to the main menu)");
+  mInstructionText.setString(InstructionString);
+  mInstructionText.setCharacterSize(InstructionSize);
+  context.glyphs -> check(mInstructionText);
   // Set instruction text's origin to be its center position.
   centerOrigin(mInstructionText);
   mInstructionText.setPosition(0.5f * viewSize.x, 0.6f * viewSize.y);
+  // Set the background shape's color to be transparent.
+  mBackgroundShape.setFillColor(sf::Color(0, 0, 0, 150));
+  // Set the background shape's size to be the same as window's default view size.
+  mBackgroundShape.setSize(context.window -> getDefaultView().getSize());
 }
 
 /**
@@ -50,14 +76,8 @@ void PauseState::draw()
   sf::RenderWindow& window = *getContext().window;
   // Set render window's view.
   window.setView(window.getDefaultView());
-  // Create a sf::RectangleShape to present a transparent rectangle background shape.
-  sf::RectangleShape backgroundShape;
-  // Set the background shape's color to be transparent.
-  backgroundShape.setFillColor(sf::Color(0, 0, 0, 150));
-  // Set the background shape's size to be the same as window's current size.
-  backgroundShape.setSize(window.getView().getSize());
-  // Draw the background shape.
-  window.draw(backgroundShape);
+  // Draw the transparent background shape.
+  window.draw(mBackgroundShape);
   // Draw the paused text.
   window.draw(mPausedText);
   // Draw the instruction text.
@@ -73,6 +93,15 @@ bool PauseState::update(sf::Time)
   return false;
 }
 
+/**
+ * The paused game below does not change, so the state stack can draw it from a frozen frame.
+ * @return a bool value indicates that the states below are frozen.
+ */
+bool PauseState::freezesStatesBelow() const
+{
+  return true;
+}
+
 /**
  * Handle each event according to the key user pressed.
  * @param event a sf::Event object indicates each input event.
@@ -87,6 +116,8 @@ bool PauseState::handleEvent(const sf::Event& event)
   // If escape pressed, remove pause state to return to the in-game state.
   if (event.key.code == sf::Keyboard::Escape)
   {
+    // Keys tapped while paused do not carry over into the game.
+    getContext().player -> clearTaps();
     requestStackPop();
   }
 
@@ -2,34 +2,40 @@
 #include "Player.hpp"
 #include "CommandQueue.hpp"
 #include "Aircraft.hpp"
+#include "InputSampler.hpp"
 
 // A AircraftMover struct helps us to change the aircraft's velocity if an arrow key is pressed.
 struct AircraftMover
 {
-  // Store the velocity we want to add to a Aircraft object.
-  sf::Vector2f velocity;
+  // Store the direction in which we want to add velocity to a Aircraft object.
+  Vector2s direction;
 
   // Constructor of AircraftMover struct.
-  AircraftMover(float vx, float vy)
-      : velocity(vx, vy)
+  AircraftMover(float dx, float dy)
+      : direction(toScalar(dx), toScalar(dy))
   {
   }
 
-  // Functor which adds velocity to a Aircraft object.
+  // Functor which adds velocity to a Aircraft object, as fast as the aircraft flies.
   void operator() (Aircraft& aircraft, sf::Time) const
   {
-    aircraft.accelerate(velocity);
+    aircraft.accelerate(direction * aircraft.getMaxSpeed());
   }
 };
 
 // Constructor of Player class.
 Player::Player()
+    : mKeyBinding()
+    , mActionBinding()
+    , mKeyDown()
+    , mKeyTapped()
 {
   // Set initial key bindings(bind key with actions).
   mKeyBinding[sf::Keyboard::Left] = MoveLeft;
   mKeyBinding[sf::Keyboard::Right] = MoveRight;
   mKeyBinding[sf::Keyboard::Up] = MoveUp;
   mKeyBinding[sf::Keyboard::Down] = MoveDown;
+  mKeyBinding[sf::Keyboard::Space] = Fire;
 
   // Set initial action bindings
   initializeActions();
@@ -57,18 +63,82 @@ void Player::handleEvent(const sf::Event& event, CommandQueue& commands)
 }
 
 /**
- * Creates a command every frame an arrow key is held down.
+ * Record a key transition sampled by the InputSampler.
+ * @param input an InputEvent indicates which key went down or up.
+ */
+void Player::handleSampledInput(const InputEvent& input)
+{
+  if (input.key < 0 || input.key >= sf::Keyboard::KeyCount)
+    return;
+
+  mKeyDown[input.key] = input.pressed;
+  if (input.pressed)
+    mKeyTapped[input.key] = true;
+}
+
+/**
+ * Creates a command every frame an arrow key is held down. The key state comes from the InputSampler instead of
+ * being polled here, so it does not depend on where in the frame the key was pressed.
  * @param commands a CommandQueue object indicates current queue of commands.
  */
 void Player::handleRealtimeInput(CommandQueue& commands)
 {
+  const unsigned int actions = sampleActions();
+
+  // Trigger the command of every action which is active this tick.
+  for (auto& pair : mActionBinding)
+  {
+    if (actions & (1u << pair.first))
+      commands.push(pair.second);
+  }
+}
+
+/**
+ * Get the realtime actions of this tick, an action is active while its key is held down or if it was tapped since
+ * the last tick. The mask is small enough to be sent over the network as the input of one tick.
+ * @return an unsigned int with the bit (1 << action) set for each active action.
+ */
+unsigned int Player::sampleActions()
+{
+  unsigned int actions = 0;
+
   // Traverse all assigned keys and check if they are pressed
-  for (auto pair : mKeyBinding)
+  for (const auto& pair : mKeyBinding)
+  {
+    if (pair.first < 0 || pair.first >= sf::Keyboard::KeyCount)
+      continue;
+
+    if ((mKeyDown[pair.first] || mKeyTapped[pair.first]) && isRealtimeAction(pair.second))
+      actions |= 1u << pair.second;
+  }
+
+  // Taps have been consumed by this tick.
+  clearTaps();
+  return actions;
+}
+
+/**
+ * Forget the keys tapped since the last tick. Sampled input reaches the player whatever state is on top, so the taps
+ * made in a menu are dropped before the game consumes realtime actions again. Keys still held down stay active.
+ */
+void Player::clearTaps()
+{
+  mKeyTapped.fill(false);
+}
+
+/**
+ * Get the keys bound to realtime actions, which have to be sampled.
+ * @return a vector of sf::Keyboard::Key objects.
+ */
+std::vector<sf::Keyboard::Key> Player::getRealtimeKeys() const
+{
+  std::vector<sf::Keyboard::Key> keys;
+  for (const auto& pair : mKeyBinding)
   {
-    // If key is pressed, lookup action and trigger corresponding command
-    if (sf::Keyboard::isKeyPressed(pair.first) && isRealtimeAction(pair.second))
-      commands.push(mActionBinding[pair.second]);
+    if (isRealtimeAction(pair.second))
+      keys.push_back(pair.first);
   }
+  return keys;
 }
 
 /**
@@ -112,13 +182,13 @@ sf::Keyboard::Key Player::getAssignedKey(Action action) const
  */
 void Player::initializeActions()
 {
-  const float playerSpeed = 200.f;
-
   // Set each action's mapping command function.
-  mActionBinding[MoveLeft].action	 = derivedAction<Aircraft>(AircraftMover(-playerSpeed, 0.f));
-  mActionBinding[MoveRight].action   = derivedAction<Aircraft>(AircraftMover(+playerSpeed, 0.f));
-  mActionBinding[MoveUp].action      = derivedAction<Aircraft>(AircraftMover(0.f, -playerSpeed));
-  mActionBinding[MoveDown].action    = derivedAction<Aircraft>(AircraftMover(0.f, +playerSpeed));
+  mActionBinding[MoveLeft].action	 = derivedAction<Aircraft>(AircraftMover(-1.f, 0.f));
+  mActionBinding[MoveRight].action   = derivedAction<Aircraft>(AircraftMover(+1.f, 0.f));
+  mActionBinding[MoveUp].action      = derivedAction<Aircraft>(AircraftMover(0.f, -1.f));
+  mActionBinding[MoveDown].action    = derivedAction<Aircraft>(AircraftMover(0.f, +1.f));
+  mActionBinding[Fire].action        = derivedAction<Aircraft>([] (Aircraft& aircraft, sf::Time)
+  { aircraft.fire(); });
 }
 
 /**
@@ -134,6 +204,7 @@ bool Player::isRealtimeAction(Action action)
     case MoveRight:
     case MoveDown:
     case MoveUp:
+    case Fire:
       return true;
 
     default:
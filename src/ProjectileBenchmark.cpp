@@ -0,0 +1,89 @@
+// Include project header files
+#include "ProjectileBenchmark.hpp"
+#include "World.hpp"
+#include "SoundSynthesizer.hpp"
+#include "NullSoundBackend.hpp"
+#include "NetworkProtocol.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/System/Clock.hpp>
+
+// Include C++ standard headers.
+#include <random>
+
+namespace
+{
+  // Ticks run before measuring, enough for the first enemies to enter the view.
+  const std::size_t WarmUpTicks = 300;
+  // Every projectile count is measured for at least this long and at least MinTicks ticks.
+  const sf::Time MinDuration = sf::seconds(1.f);
+  const std::size_t MinTicks = 60;
+  // Fastest speed of the projectiles along each axis, slow enough that they stay in the view during a tick.
+  const float ProjectileSpeed = 50.f;
+  // The world plays nothing audible, one voice is enough.
+  const std::size_t SoundVoiceCount = 1;
+}
+
+/**
+ * Run a headless world until enemies are on screen, save its state, then measure it with 10k, 50k and 65k live
+ * projectiles(the pool holds 65536). Each measured tick starts from the same state, so the projectiles used up by
+ * a tick are back for the next one.
+ * @param out a std::ostream object indicates where the results are written to.
+ */
+void ProjectileBenchmark::run(std::ostream& out)
+{
+  SoundHolder soundBuffers;
+  SoundPlayer sounds(SoundSynthesizer::synthesizeAll(soundBuffers),
+                     SoundBackend::Ptr(new NullSoundBackend(SoundVoiceCount)));
+  World world(Network::ViewSize, sounds);
+  // Nothing is heard or seen, so effects only cost time which is not the projectiles'.
+  world.setEffectsEnabled(false);
+
+  for (std::size_t i = 0; i < WarmUpTicks; ++i)
+    world.update(Network::TimePerTick);
+
+  World::State state;
+  world.saveState(state);
+  const sf::Vector2f center = toFloat(state.viewCenter);
+
+  const std::size_t projectileCounts[] = { 10000, 50000, 65000 };
+  for (std::size_t projectileCount : projectileCounts)
+  {
+    // Spread projectiles of both sides over the view, moving slowly in every direction.
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> xDistribution(center.x - Network::ViewSize.x / 2.f,
+                                                        center.x + Network::ViewSize.x / 2.f);
+    std::uniform_real_distribution<float> yDistribution(center.y - Network::ViewSize.y / 2.f,
+                                                        center.y + Network::ViewSize.y / 2.f);
+    std::uniform_real_distribution<float> speedDistribution(-ProjectileSpeed, ProjectileSpeed);
+
+    ProjectileSystem::State& projectiles = state.projectiles;
+    projectiles.positionsX.resize(projectileCount);
+    projectiles.positionsY.resize(projectileCount);
+    projectiles.velocitiesX.resize(projectileCount);
+    projectiles.velocitiesY.resize(projectileCount);
+    projectiles.sides.resize(projectileCount);
+    for (std::size_t i = 0; i < projectileCount; ++i)
+    {
+      projectiles.positionsX[i] = toScalar(xDistribution(random));
+      projectiles.positionsY[i] = toScalar(yDistribution(random));
+      projectiles.velocitiesX[i] = toScalar(speedDistribution(random));
+      projectiles.velocitiesY[i] = toScalar(speedDistribution(random));
+      projectiles.sides[i] = i % 2 == 0 ? ProjectileSystem::Allied : ProjectileSystem::Enemy;
+    }
+
+    std::size_t ticks = 0;
+    sf::Time elapsed = sf::Time::Zero;
+    while (ticks < MinTicks || elapsed < MinDuration)
+    {
+      world.restoreState(state);
+      sf::Clock clock;
+      world.update(Network::TimePerTick);
+      elapsed += clock.getElapsedTime();
+      ++ticks;
+    }
+
+    out << projectileCount << " projectiles: " << elapsed.asMicroseconds() / ticks << " us per tick" << std::endl;
+  }
+}
@@ -0,0 +1,336 @@
+// Include project header files
+#include "ProjectileSystem.hpp"
+#include "CollisionSystem.hpp"
+#include "StateHash.hpp"
+#include "Snapshot.hpp"
+#include "SaveGame.hpp"
+#include "Category.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Graphics/RenderTarget.hpp>
+
+// Include C++ standard headers.
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+namespace
+{
+  // Half the edge length of a projectile's quad.
+  const float HalfSize = 2.f;
+  // Colors of allied and enemy projectiles.
+  const sf::Color AlliedColor(255, 230, 80);
+  const sf::Color EnemyColor(255, 80, 200);
+}
+
+/**
+ * Constructor of ProjectileSystem class, allocate the whole pool so that spawning never allocates.
+ * @param capacity a std::size_t indicates the maximum number of live projectiles.
+ */
+ProjectileSystem::ProjectileSystem(std::size_t capacity)
+    : mPositionsX(capacity)
+    , mPositionsY(capacity)
+    , mVelocitiesX(capacity)
+    , mVelocitiesY(capacity)
+    , mSides(capacity, Allied)
+    , mDestroyed(capacity, false)
+    , mVertices(capacity * 4)
+    , mCount(0)
+    , mBounds()
+{
+}
+
+/**
+ * Add one projectile.
+ * @param side an enum indicates who fired the projectile.
+ * @param position a Vector2s indicates the world position of the projectile.
+ * @param velocity a Vector2s indicates the velocity of the projectile.
+ * @return a bool value indicates whether the projectile was added(false if the pool is full).
+ */
+bool ProjectileSystem::spawn(Side side, Vector2s position, Vector2s velocity)
+{
+  if (mCount == mSides.size())
+    return false;
+
+  mPositionsX[mCount] = position.x;
+  mPositionsY[mCount] = position.y;
+  mVelocitiesX[mCount] = velocity.x;
+  mVelocitiesY[mCount] = velocity.y;
+  mSides[mCount] = side;
+  mDestroyed[mCount] = false;
+  writeQuad(mCount);
+  ++mCount;
+  return true;
+}
+
+/**
+ * Set the area outside of which projectiles are removed on the next update.
+ * @param bounds a sf::FloatRect indicates the area in world coordinates.
+ */
+void ProjectileSystem::setBounds(const sf::FloatRect& bounds)
+{
+  mBounds = bounds;
+}
+
+/**
+ * Remove every projectile.
+ */
+void ProjectileSystem::clear()
+{
+  mCount = 0;
+}
+
+/**
+ * Flag one projectile for removal. Slots do not move until removeDestroyed(), so indices handed out as collision
+ * bodies stay valid until then.
+ * @param index a std::size_t indicates the slot of the projectile.
+ */
+void ProjectileSystem::destroy(std::size_t index)
+{
+  assert(index < mCount);
+  mDestroyed[index] = true;
+}
+
+/**
+ * Check whether one projectile is flagged for removal, a projectile which is used up hits nothing else.
+ * @param index a std::size_t indicates the slot of the projectile.
+ * @return a bool value indicates whether the projectile is flagged.
+ */
+bool ProjectileSystem::isDestroyed(std::size_t index) const
+{
+  assert(index < mCount);
+  return mDestroyed[index];
+}
+
+/**
+ * Remove every flagged projectile in one pass.
+ */
+void ProjectileSystem::removeDestroyed()
+{
+  for (std::size_t i = 0; i < mCount;)
+  {
+    if (mDestroyed[i])
+    {
+      // The last projectile moves into slot i, which is checked again.
+      remove(i);
+      continue;
+    }
+
+    writeQuad(i);
+    ++i;
+  }
+}
+
+/**
+ * Copy the live projectiles into a saved state, none may be flagged for removal. The arrays are copied as a whole
+ * and the state reuses its room, so saving never allocates once warmed up.
+ * @param state a State object receiving the projectiles.
+ */
+void ProjectileSystem::saveState(State& state) const
+{
+  state.positionsX.assign(mPositionsX.begin(), mPositionsX.begin() + mCount);
+  state.positionsY.assign(mPositionsY.begin(), mPositionsY.begin() + mCount);
+  state.velocitiesX.assign(mVelocitiesX.begin(), mVelocitiesX.begin() + mCount);
+  state.velocitiesY.assign(mVelocitiesY.begin(), mVelocitiesY.begin() + mCount);
+  state.sides.assign(mSides.begin(), mSides.begin() + mCount);
+}
+
+/**
+ * Bring the live projectiles back from a saved state and write their quads.
+ * @param state a State object indicates the saved projectiles.
+ */
+void ProjectileSystem::restoreState(const State& state)
+{
+  mCount = state.sides.size();
+  assert(mCount <= getCapacity());
+
+  std::copy(state.positionsX.begin(), state.positionsX.end(), mPositionsX.begin());
+  std::copy(state.positionsY.begin(), state.positionsY.end(), mPositionsY.begin());
+  std::copy(state.velocitiesX.begin(), state.velocitiesX.end(), mVelocitiesX.begin());
+  std::copy(state.velocitiesY.begin(), state.velocitiesY.end(), mVelocitiesY.begin());
+  std::copy(state.sides.begin(), state.sides.end(), mSides.begin());
+  std::fill(mDestroyed.begin(), mDestroyed.begin() + mCount, false);
+
+  for (std::size_t i = 0; i < mCount; ++i)
+    writeQuad(i);
+}
+
+/**
+ * Write the live projectiles into a saved game: their number, then each array with one copy.
+ * @param save a SaveGame object indicates where the projectiles are written to.
+ */
+void ProjectileSystem::save(SaveGame& save) const
+{
+  save.write(static_cast<std::uint32_t>(mCount));
+  save.writeArray(mPositionsX.data(), mCount);
+  save.writeArray(mPositionsY.data(), mCount);
+  save.writeArray(mVelocitiesX.data(), mCount);
+  save.writeArray(mVelocitiesY.data(), mCount);
+  save.writeArray(mSides.data(), mCount);
+}
+
+/**
+ * Replace the live projectiles by the ones of a saved game and write their quads.
+ * @param save a SaveGame object indicates where the projectiles are read from.
+ */
+void ProjectileSystem::load(SaveGame& save)
+{
+  const std::size_t count = save.read<std::uint32_t>();
+  if (count > getCapacity())
+    throw std::runtime_error("ProjectileSystem::load - The saved game holds too many projectiles");
+
+  mCount = 0;
+  save.readArray(mPositionsX.data(), count);
+  save.readArray(mPositionsY.data(), count);
+  save.readArray(mVelocitiesX.data(), count);
+  save.readArray(mVelocitiesY.data(), count);
+  save.readArray(mSides.data(), count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    if (mSides[i] != Allied && mSides[i] != Enemy)
+      throw std::runtime_error("ProjectileSystem::load - The saved game holds an unknown projectile");
+  }
+  mCount = count;
+  std::fill(mDestroyed.begin(), mDestroyed.begin() + mCount, false);
+
+  for (std::size_t i = 0; i < mCount; ++i)
+    writeQuad(i);
+}
+
+/**
+ * Get the number of live projectiles.
+ * @return a std::size_t indicates the number of live projectiles.
+ */
+std::size_t ProjectileSystem::getCount() const
+{
+  return mCount;
+}
+
+/**
+ * Get the maximum number of live projectiles.
+ * @return a std::size_t indicates the capacity of the pool.
+ */
+std::size_t ProjectileSystem::getCapacity() const
+{
+  return mSides.size();
+}
+
+/**
+ * Integrate all projectiles, remove those which left the bounds and write the quads of the others, in one pass.
+ * @param dt a sf::Time object indicates the current frame time.
+ */
+void ProjectileSystem::updateCurrent(sf::Time dt)
+{
+  const Scalar seconds = toScalar(dt);
+  const Scalar left = toScalar(mBounds.left);
+  const Scalar top = toScalar(mBounds.top);
+  const Scalar right = toScalar(mBounds.left + mBounds.width);
+  const Scalar bottom = toScalar(mBounds.top + mBounds.height);
+
+  for (std::size_t i = 0; i < mCount;)
+  {
+    Scalar x = mPositionsX[i] += mVelocitiesX[i] * seconds;
+    Scalar y = mPositionsY[i] += mVelocitiesY[i] * seconds;
+
+    if (x < left || x >= right || y < top || y >= bottom)
+    {
+      // The last projectile moves into slot i, which is visited again.
+      remove(i);
+      continue;
+    }
+
+    writeQuad(i);
+    ++i;
+  }
+}
+
+/**
+ * Add every projectile as a collision body, the body index is the projectile's slot in the pool.
+ * @param collisions a CollisionSystem object indicates where the bodies are added.
+ */
+void ProjectileSystem::collectCurrentBodies(CollisionSystem& collisions)
+{
+  for (std::size_t i = 0; i < mCount; ++i)
+  {
+    unsigned int category = mSides[i] == Allied ? Category::AlliedProjectile : Category::EnemyProjectile;
+    sf::FloatRect bounds(toFloat(mPositionsX[i]) - HalfSize, toFloat(mPositionsY[i]) - HalfSize,
+                         2.f * HalfSize, 2.f * HalfSize);
+    collisions.addBody(bounds, category, *this, i);
+  }
+}
+
+/**
+ * Add the number of projectiles, then the position, velocity and category of each one to a checksum.
+ * @param hash a StateHash object indicates the checksum.
+ */
+void ProjectileSystem::hashCurrentState(StateHash& hash)
+{
+  hash.addInteger(mCount);
+  for (std::size_t i = 0; i < mCount; ++i)
+  {
+    hash.addScalar(mPositionsX[i]);
+    hash.addScalar(mPositionsY[i]);
+    hash.addScalar(mVelocitiesX[i]);
+    hash.addScalar(mVelocitiesY[i]);
+    hash.addInteger(mSides[i] == Allied ? Category::AlliedProjectile : Category::EnemyProjectile);
+  }
+}
+
+/**
+ * Write the category and position of every projectile into a snapshot.
+ * @param snapshot a Snapshot object indicates where the state is written to.
+ */
+void ProjectileSystem::writeCurrentSnapshot(Snapshot& snapshot)
+{
+  for (std::size_t i = 0; i < mCount; ++i)
+  {
+    unsigned int category = mSides[i] == Allied ? Category::AlliedProjectile : Category::EnemyProjectile;
+    snapshot.addObject(category, sf::Vector2f(toFloat(mPositionsX[i]), toFloat(mPositionsY[i])));
+  }
+}
+
+/**
+ * Draw all projectiles with one draw call.
+ * @param target indicates the sf::RenderTarget object we want to draw to
+ * @param states indicates the render states of the parent node
+ */
+void ProjectileSystem::drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const
+{
+  if (mCount > 0)
+    target.draw(&mVertices[0], mCount * 4, sf::Quads, states);
+}
+
+/**
+ * Move the last projectile into a slot, which removes the projectile in that slot.
+ * @param index a std::size_t indicates the slot of the projectile to remove.
+ */
+void ProjectileSystem::remove(std::size_t index)
+{
+  assert(index < mCount);
+
+  --mCount;
+  mPositionsX[index] = mPositionsX[mCount];
+  mPositionsY[index] = mPositionsY[mCount];
+  mVelocitiesX[index] = mVelocitiesX[mCount];
+  mVelocitiesY[index] = mVelocitiesY[mCount];
+  mSides[index] = mSides[mCount];
+  mDestroyed[index] = mDestroyed[mCount];
+}
+
+/**
+ * Write the quad of one projectile into the vertex array.
+ * @param index a std::size_t indicates the slot of the projectile.
+ */
+void ProjectileSystem::writeQuad(std::size_t index)
+{
+  const float x = toFloat(mPositionsX[index]);
+  const float y = toFloat(mPositionsY[index]);
+  const sf::Color& color = mSides[index] == Allied ? AlliedColor : EnemyColor;
+
+  sf::Vertex* quad = &mVertices[index * 4];
+  quad[0].position = sf::Vector2f(x - HalfSize, y - HalfSize);
+  quad[1].position = sf::Vector2f(x + HalfSize, y - HalfSize);
+  quad[2].position = sf::Vector2f(x + HalfSize, y + HalfSize);
+  quad[3].position = sf::Vector2f(x - HalfSize, y + HalfSize);
+  quad[0].color = quad[1].color = quad[2].color = quad[3].color = color;
+}
@@ -0,0 +1,100 @@
+// Include project header files
+#include "RollbackApplication.hpp"
+#include "InputSampler.hpp"
+#include "NullSoundBackend.hpp"
+#include "SoundSynthesizer.hpp"
+#include "NetworkProtocol.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Window/Event.hpp>
+#include <SFML/System/Clock.hpp>
+
+namespace
+{
+  // Frames drawn per second, one tick is simulated per frame.
+  const unsigned int FrameRate = 60;
+  // The world plays nothing, one voice is enough.
+  const std::size_t SoundVoiceCount = 1;
+  // Number of players, the local one and the remote one.
+  const std::size_t PlayerCount = 2;
+}
+
+/**
+ * Constructor of RollbackApplication class, opens the window, builds the world of both players and binds the local
+ * port. The remote peer runs on the same machine.
+ * @param localPlayer a std::size_t indicates the index of the local player(0 or 1).
+ * @param localPort an unsigned short indicates the port to bind.
+ * @param remotePort an unsigned short indicates the port of the remote peer.
+ * @param latency a sf::Time object indicates the artificial delay of every outgoing datagram.
+ */
+RollbackApplication::RollbackApplication(std::size_t localPlayer, unsigned short localPort,
+                                         unsigned short remotePort, sf::Time latency)
+    : mWindow(sf::VideoMode(static_cast<unsigned int>(Network::ViewSize.x),
+                            static_cast<unsigned int>(Network::ViewSize.y)), "Space Shooter Game", sf::Style::Close)
+    , mSoundBuffers()
+    , mSoundPlayer(SoundSynthesizer::synthesizeAll(mSoundBuffers), SoundBackend::Ptr(new NullSoundBackend(SoundVoiceCount)))
+    , mWorld(mWindow, mSoundPlayer, PlayerCount)
+    , mPlayer()
+    , mSession(mWorld, localPlayer, localPort, sf::IpAddress::LocalHost, remotePort, latency)
+    , mPacer()
+    , mPendingActions(0)
+{
+  mPacer.setTargetFrameRate(FrameRate);
+}
+
+/**
+ * Play until the window is closed, writing the statistics of the session every second.
+ * @param out a std::ostream object indicates where the statistics are written to.
+ */
+void RollbackApplication::run(std::ostream& out)
+{
+  sf::Clock statisticsClock;
+
+  while (mWindow.isOpen())
+  {
+    processInput();
+
+    // A tap during a stalled frame is kept for the next tick.
+    mPendingActions |= mPlayer.sampleActions();
+    if (mSession.advance(mPendingActions))
+      mPendingActions = 0;
+
+    render();
+
+    if (statisticsClock.getElapsedTime() >= sf::seconds(1.f))
+    {
+      statisticsClock.restart();
+      const RollbackSession::Statistics& statistics = mSession.getStatistics();
+      out << "tick " << mSession.getTick() << ": " << statistics.rollbacks << " rollbacks, "
+          << statistics.resimulatedTicks << " ticks simulated again(at most " << statistics.mostResimulatedTicks
+          << " in a frame), " << statistics.stalls << " stalls, " << statistics.desyncs << " desyncs" << std::endl;
+    }
+
+    mPacer.waitForNextFrame();
+  }
+}
+
+/**
+ * Handle the events of the window. Key transitions go to the local player directly, there is no sampling thread.
+ */
+void RollbackApplication::processInput()
+{
+  sf::Event event{};
+  while (mWindow.pollEvent(event))
+  {
+    if (event.type == sf::Event::Closed)
+      mWindow.close();
+    else if (event.type == sf::Event::KeyPressed || event.type == sf::Event::KeyReleased)
+      mPlayer.handleSampledInput(InputEvent(event.key.code, event.type == sf::Event::KeyPressed, sf::Time::Zero));
+  }
+}
+
+/**
+ * Draw the world.
+ */
+void RollbackApplication::render()
+{
+  mWindow.clear();
+  mWorld.draw();
+  mWindow.display();
+}
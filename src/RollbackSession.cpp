@@ -0,0 +1,323 @@
+// Include project header files
+#include "RollbackSession.hpp"
+#include "Utility.hpp"
+
+// Include C++ standard headers.
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+const std::size_t RollbackSession::MaxRollback;
+const std::size_t RollbackSession::InputHistorySize;
+const std::size_t RollbackSession::StateCount;
+
+namespace
+{
+  // Most inputs sent in one datagram, the remote peer never lacks more than twice the rollback window.
+  const std::size_t MaxInputsPerPacket = 2 * RollbackSession::MaxRollback;
+  // The checksum of every tick which is a multiple of this is compared.
+  const std::uint32_t ChecksumInterval = 60;
+  // Marks an input slot, state slot or checksum which holds no tick.
+  const std::uint32_t NoTick = 0xFFFFFFFF;
+}
+
+/**
+ * Constructor of RollbackSession class, binds the local port. Both peers start from the world as it is.
+ * @param world a World object indicates the world simulated, it needs two players.
+ * @param localPlayer a std::size_t indicates the index of the local player(0 or 1).
+ * @param localPort an unsigned short indicates the port to bind.
+ * @param remote a sf::IpAddress indicates the address of the remote peer.
+ * @param remotePort an unsigned short indicates the port of the remote peer.
+ * @param latency a sf::Time object indicates the artificial delay of every outgoing datagram.
+ */
+RollbackSession::RollbackSession(World& world, std::size_t localPlayer, unsigned short localPort,
+                                 const sf::IpAddress& remote, unsigned short remotePort, sf::Time latency)
+    : mWorld(world)
+    , mLocalPlayer(localPlayer)
+    , mRemote(remote)
+    , mRemotePort(remotePort)
+    , mSocket()
+    , mLatency(latency)
+    , mDelayed()
+    , mClock()
+    , mTick(0)
+    , mLocalInputs()
+    , mUsedRemoteInputs()
+    , mRemoteInputs()
+    , mRemoteInputTicks()
+    , mConfirmedRemoteTicks(0)
+    , mAcknowledgedLocalTicks(0)
+    , mPredictedInput(0)
+    , mRollbackTick(NoTick)
+    , mStates()
+    , mStateTicks()
+    , mStateChecksums()
+    , mNextChecksumTick(0)
+    , mLocalChecksum()
+    , mRemoteChecksum()
+    , mPacket()
+    , mStatistics()
+{
+  if (localPlayer > 1)
+    throw std::runtime_error("RollbackSession::RollbackSession - The local player must be 0 or 1");
+  if (mSocket.bind(localPort) != sf::Socket::Done)
+    throw std::runtime_error("RollbackSession::RollbackSession - Failed to bind port " + toString(localPort));
+  mSocket.setBlocking(false);
+
+  mRemoteInputTicks.fill(NoTick);
+  mStateTicks.fill(NoTick);
+  mLocalChecksum.tick = NoTick;
+  mRemoteChecksum.tick = NoTick;
+}
+
+/**
+ * Simulate the next tick. Remote inputs received since the last frame are confirmed first, and a misprediction
+ * among them rolls the world back. The tick is not simulated while the local peer is MaxRollback ticks ahead of the
+ * confirmed remote input, the local actions have to be given again next frame then.
+ * @param localActions an unsigned int indicates the actions(a mask of Player::Action bits) of the local player.
+ * @return a bool value indicates whether the tick was simulated.
+ */
+bool RollbackSession::advance(unsigned int localActions)
+{
+  flush();
+  receive();
+
+  // Both peers end up simulating the confirmed ticks with the same input.
+  if (mRollbackTick != NoTick)
+    rollback();
+  sendChecksums();
+
+  if (mTick >= mConfirmedRemoteTicks + MaxRollback)
+  {
+    ++mStatistics.stalls;
+    // The remote peer may be waiting for inputs which got lost.
+    sendInputs();
+    return false;
+  }
+
+  mLocalInputs[mTick % InputHistorySize] = localActions;
+  simulate(mTick);
+  ++mTick;
+  ++mStatistics.ticks;
+
+  sendInputs();
+  flush();
+  return true;
+}
+
+/**
+ * Get the number of ticks simulated.
+ * @return a 32-bit integer indicates the number of ticks.
+ */
+std::uint32_t RollbackSession::getTick() const
+{
+  return mTick;
+}
+
+/**
+ * Get what the session did so far.
+ * @return a Statistics object indicates the statistics.
+ */
+const RollbackSession::Statistics& RollbackSession::getStatistics() const
+{
+  return mStatistics;
+}
+
+/**
+ * Read every datagram waiting on the socket, datagrams from anywhere but the remote peer are ignored.
+ */
+void RollbackSession::receive()
+{
+  sf::IpAddress address;
+  unsigned short port;
+  while (mSocket.receive(mPacket, address, port) == sf::Socket::Done)
+  {
+    if (address != mRemote || port != mRemotePort)
+      continue;
+
+    sf::Uint8 message;
+    if (!(mPacket >> message))
+      continue;
+
+    if (message == Network::PeerInput)
+      readInputs(mPacket);
+    else if (message == Network::PeerChecksum)
+    {
+      sf::Uint32 tick, high, low;
+      if (!(mPacket >> tick >> high >> low))
+        continue;
+      mRemoteChecksum.tick = tick;
+      mRemoteChecksum.value = static_cast<std::uint64_t>(high) << 32 | low;
+      compareChecksums();
+    }
+  }
+}
+
+/**
+ * Store the remote inputs of a datagram and confirm the ones received in order. A confirmed input which differs
+ * from the one the simulation used for an earlier tick calls for a rollback to that tick.
+ * @param packet a sf::Packet object indicates the datagram, after its message type.
+ */
+void RollbackSession::readInputs(sf::Packet& packet)
+{
+  sf::Uint32 acknowledged, firstTick;
+  sf::Uint8 count;
+  if (!(packet >> acknowledged >> firstTick >> count))
+    return;
+  mAcknowledgedLocalTicks = std::max<std::uint32_t>(mAcknowledgedLocalTicks, std::min(acknowledged, mTick));
+
+  for (std::uint32_t tick = firstTick; tick < firstTick + count; ++tick)
+  {
+    sf::Uint8 actions;
+    if (!(packet >> actions))
+      return;
+    // Inputs before the window are confirmed already, the ones past it cannot be stored yet.
+    if (tick < mConfirmedRemoteTicks || tick >= mConfirmedRemoteTicks + InputHistorySize)
+      continue;
+
+    mRemoteInputs[tick % InputHistorySize] = actions;
+    mRemoteInputTicks[tick % InputHistorySize] = tick;
+  }
+
+  while (mRemoteInputTicks[mConfirmedRemoteTicks % InputHistorySize] == mConfirmedRemoteTicks)
+  {
+    const std::uint32_t tick = mConfirmedRemoteTicks;
+    const unsigned int actions = mRemoteInputs[tick % InputHistorySize];
+    if (tick < mTick && mUsedRemoteInputs[tick % InputHistorySize] != actions)
+      mRollbackTick = std::min(mRollbackTick, tick);
+
+    mPredictedInput = actions;
+    ++mConfirmedRemoteTicks;
+  }
+}
+
+/**
+ * Save the world, then simulate one tick with the local input and the remote input confirmed for it or predicted.
+ * @param tick a 32-bit integer indicates the tick.
+ */
+void RollbackSession::simulate(std::uint32_t tick)
+{
+  const std::size_t slot = tick % StateCount;
+  mWorld.saveState(mStates[slot]);
+  mStateTicks[slot] = tick;
+  if (tick % ChecksumInterval == 0)
+    mStateChecksums[slot] = mWorld.computeChecksum();
+
+  const std::size_t input = tick % InputHistorySize;
+  mUsedRemoteInputs[input] = tick < mConfirmedRemoteTicks ? mRemoteInputs[input] : mPredictedInput;
+
+  mWorld.setPlayerActions(mLocalPlayer, mLocalInputs[input]);
+  mWorld.setPlayerActions(1 - mLocalPlayer, mUsedRemoteInputs[input]);
+  mWorld.update(Network::TimePerTick);
+}
+
+/**
+ * Restore the world to the start of the earliest mispredicted tick and simulate the ticks since again. Particles
+ * are not part of the saved state, so they are not spawned again for ticks which were already shown.
+ */
+void RollbackSession::rollback()
+{
+  const std::uint32_t first = mRollbackTick;
+  mRollbackTick = NoTick;
+  assert(mTick - first <= MaxRollback && mStateTicks[first % StateCount] == first);
+
+  mWorld.restoreState(mStates[first % StateCount]);
+  mWorld.setEffectsEnabled(false);
+  for (std::uint32_t tick = first; tick < mTick; ++tick)
+    simulate(tick);
+  mWorld.setEffectsEnabled(true);
+
+  const std::size_t resimulated = mTick - first;
+  ++mStatistics.rollbacks;
+  mStatistics.resimulatedTicks += resimulated;
+  mStatistics.mostResimulatedTicks = std::max(mStatistics.mostResimulatedTicks, resimulated);
+}
+
+/**
+ * Send the local inputs from the first one the remote peer lacks(according to its last datagram), at most
+ * MaxInputsPerPacket of the newest ones. Inputs are resent until acknowledged, so a lost datagram costs nothing.
+ */
+void RollbackSession::sendInputs()
+{
+  std::uint32_t first = mAcknowledgedLocalTicks;
+  if (mTick - first > MaxInputsPerPacket)
+    first = mTick - static_cast<std::uint32_t>(MaxInputsPerPacket);
+
+  mPacket.clear();
+  mPacket << static_cast<sf::Uint8>(Network::PeerInput) << static_cast<sf::Uint32>(mConfirmedRemoteTicks)
+          << static_cast<sf::Uint32>(first) << static_cast<sf::Uint8>(mTick - first);
+  for (std::uint32_t tick = first; tick < mTick; ++tick)
+    mPacket << static_cast<sf::Uint8>(mLocalInputs[tick % InputHistorySize]);
+  send(mPacket);
+}
+
+/**
+ * Send the checksums of the ticks which became confirmed: the world at the start of a tick only depends on
+ * confirmed input once the remote inputs of every tick before it are confirmed.
+ */
+void RollbackSession::sendChecksums()
+{
+  while (mNextChecksumTick < mTick && mNextChecksumTick <= mConfirmedRemoteTicks)
+  {
+    const std::size_t slot = mNextChecksumTick % StateCount;
+    assert(mStateTicks[slot] == mNextChecksumTick);
+
+    mLocalChecksum.tick = mNextChecksumTick;
+    mLocalChecksum.value = mStateChecksums[slot];
+    mNextChecksumTick += ChecksumInterval;
+
+    mPacket.clear();
+    mPacket << static_cast<sf::Uint8>(Network::PeerChecksum) << static_cast<sf::Uint32>(mLocalChecksum.tick)
+            << static_cast<sf::Uint32>(mLocalChecksum.value >> 32)
+            << static_cast<sf::Uint32>(mLocalChecksum.value & 0xFFFFFFFF);
+    send(mPacket);
+    compareChecksums();
+  }
+}
+
+/**
+ * Compare the local and remote checksums once both peers sent the one of the same tick, a difference means that
+ * the worlds diverged although they were simulated with the same input.
+ */
+void RollbackSession::compareChecksums()
+{
+  if (mLocalChecksum.tick == NoTick || mLocalChecksum.tick != mRemoteChecksum.tick)
+    return;
+
+  if (mLocalChecksum.value != mRemoteChecksum.value)
+    ++mStatistics.desyncs;
+  mLocalChecksum.tick = NoTick;
+  mRemoteChecksum.tick = NoTick;
+}
+
+/**
+ * Send a datagram to the remote peer once the artificial latency has passed(at once without latency).
+ * @param packet a sf::Packet object indicates the datagram.
+ */
+void RollbackSession::send(const sf::Packet& packet)
+{
+  if (mLatency == sf::Time::Zero)
+  {
+    sf::Packet copy(packet);
+    mSocket.send(copy, mRemote, mRemotePort);
+    return;
+  }
+
+  DelayedPacket delayed;
+  delayed.due = mClock.getElapsedTime() + mLatency;
+  delayed.packet = packet;
+  mDelayed.push(delayed);
+}
+
+/**
+ * Send the delayed datagrams which are due, in the order they were delayed.
+ */
+void RollbackSession::flush()
+{
+  const sf::Time now = mClock.getElapsedTime();
+  while (!mDelayed.empty() && mDelayed.front().due <= now)
+  {
+    mSocket.send(mDelayed.front().packet, mRemote, mRemotePort);
+    mDelayed.pop();
+  }
+}
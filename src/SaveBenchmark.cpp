@@ -0,0 +1,55 @@
+// Include project header files
+#include "SaveBenchmark.hpp"
+#include "SaveGame.hpp"
+#include "World.hpp"
+#include "Player.hpp"
+#include "NullSoundBackend.hpp"
+#include "SoundSynthesizer.hpp"
+#include "NetworkProtocol.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/System/Clock.hpp>
+
+namespace
+{
+  // Ticks run before measuring, enough for the enemies to fill the view with projectiles.
+  const std::size_t WarmUpTicks = 600;
+  // Number of saves and loads measured.
+  const std::size_t Iterations = 1000;
+  // The world plays nothing, one voice is enough.
+  const std::size_t SoundVoiceCount = 1;
+}
+
+/**
+ * Run a headless world with the player firing all the time, then save it and load it back again and again. Each
+ * load restores the same save, so every iteration handles the same number of objects.
+ * @param out a std::ostream object indicates where the results are written to.
+ */
+void SaveBenchmark::run(std::ostream& out)
+{
+  SoundHolder soundBuffers;
+  SoundPlayer sounds(SoundSynthesizer::synthesizeAll(soundBuffers), SoundBackend::Ptr(new NullSoundBackend(SoundVoiceCount)));
+  World world(Network::ViewSize, sounds);
+
+  for (std::size_t i = 0; i < WarmUpTicks; ++i)
+  {
+    world.setPlayerActions(0, 1u << Player::Fire);
+    world.update(Network::TimePerTick);
+  }
+
+  SaveGame save;
+  sf::Time saveTime = sf::Time::Zero;
+  sf::Time loadTime = sf::Time::Zero;
+  for (std::size_t i = 0; i < Iterations; ++i)
+  {
+    sf::Clock clock;
+    world.saveGame(save);
+    saveTime += clock.restart();
+    world.loadGame(save);
+    loadTime += clock.getElapsedTime();
+  }
+
+  out << save.getSize() << " bytes per save, " << saveTime.asMicroseconds() / Iterations << " us per save, "
+      << loadTime.asMicroseconds() / Iterations << " us per load" << std::endl;
+}
@@ -0,0 +1,145 @@
+// Include project header files
+#include "SaveGame.hpp"
+#include "Scalar.hpp"
+
+// Include C++ standard headers.
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+const std::uint32_t SaveGame::Magic;
+const std::uint32_t SaveGame::Version;
+
+/**
+ * Constructor of SaveGame class, the save holds nothing until it is cleared or loaded.
+ */
+SaveGame::SaveGame()
+    : mData()
+    , mReadPosition(0)
+{
+}
+
+/**
+ * Drop everything and write the header of a new save. The room of the buffer is kept, so saving again never
+ * allocates once a save of the same size was written.
+ */
+void SaveGame::clear()
+{
+  mData.clear();
+  mReadPosition = 0;
+  write(Magic);
+  write(Version);
+  write(getScalarFormat());
+}
+
+/**
+ * Reserve room, so that writing up to that many bytes never reallocates.
+ * @param size a std::size_t indicates the number of bytes.
+ */
+void SaveGame::reserve(std::size_t size)
+{
+  mData.reserve(size);
+}
+
+/**
+ * Check the header and start reading from the first value after it.
+ */
+void SaveGame::rewind()
+{
+  mReadPosition = 0;
+  if (read<std::uint32_t>() != Magic)
+    throw std::runtime_error("SaveGame::rewind - Not a saved game");
+  if (read<std::uint32_t>() != Version)
+    throw std::runtime_error("SaveGame::rewind - The saved game has another version");
+  if (read<std::uint32_t>() != getScalarFormat())
+    throw std::runtime_error("SaveGame::rewind - The saved game was written with another number format");
+}
+
+/**
+ * Write the whole save into a file, replacing it.
+ * @param filename a std::string indicates the path of the file.
+ */
+void SaveGame::saveToFile(const std::string& filename) const
+{
+  std::ofstream file(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file || !file.write(mData.data(), mData.size()) || !file.flush())
+    throw std::runtime_error("SaveGame::saveToFile - Failed to write " + filename);
+}
+
+/**
+ * Replace the save by the content of a file, which is read with one call.
+ * @param filename a std::string indicates the path of the file.
+ */
+void SaveGame::loadFromFile(const std::string& filename)
+{
+  std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+  if (!file)
+    throw std::runtime_error("SaveGame::loadFromFile - Failed to open " + filename);
+
+  const std::streamoff size = file.tellg();
+  mData.resize(static_cast<std::size_t>(size));
+  mReadPosition = 0;
+  if (!file.seekg(0) || !file.read(mData.data(), size))
+    throw std::runtime_error("SaveGame::loadFromFile - Failed to read " + filename);
+}
+
+/**
+ * Exchange the buffers of two saves, e.g. to hand a save over to a SaveGameWriter without copying it.
+ * @param other a SaveGame object indicates the other save.
+ */
+void SaveGame::swap(SaveGame& other)
+{
+  mData.swap(other.mData);
+  std::swap(mReadPosition, other.mReadPosition);
+}
+
+/**
+ * Get the size of the save in bytes.
+ * @return a std::size_t indicates the size.
+ */
+std::size_t SaveGame::getSize() const
+{
+  return mData.size();
+}
+
+/**
+ * Append raw bytes to the save.
+ * @param data a pointer to the bytes.
+ * @param size a std::size_t indicates the number of bytes.
+ */
+void SaveGame::writeBytes(const void* data, std::size_t size)
+{
+  const std::size_t offset = mData.size();
+  mData.resize(offset + size);
+  if (size > 0)
+    std::memcpy(&mData[offset], data, size);
+}
+
+/**
+ * Read the next raw bytes of the save.
+ * @param data a pointer to room for the bytes.
+ * @param size a std::size_t indicates the number of bytes.
+ */
+void SaveGame::readBytes(void* data, std::size_t size)
+{
+  if (size > mData.size() - mReadPosition)
+    throw std::runtime_error("SaveGame::readBytes - The saved game ends unexpectedly");
+
+  if (size > 0)
+    std::memcpy(data, &mData[mReadPosition], size);
+  mReadPosition += size;
+}
+
+/**
+ * Get the format of the simulation's numbers in this build: their size, plus a flag for fixed-point.
+ * @return a 32-bit integer indicates the format.
+ */
+std::uint32_t SaveGame::getScalarFormat()
+{
+#ifdef FIXED_POINT_SIMULATION
+  return 0x100 | sizeof(Scalar);
+#else
+  return sizeof(Scalar);
+#endif
+}
@@ -0,0 +1,112 @@
+// Include project header files
+#include "SaveGameWriter.hpp"
+
+// Include C++ standard headers.
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+
+// Include platform headers for replacing files.
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+/**
+ * Constructor of SaveGameWriter class, start the background thread.
+ */
+SaveGameWriter::SaveGameWriter()
+    : mSave()
+    , mFilename()
+    , mIsWriting(false)
+    , mMutex()
+    , mCondition()
+    , mRunning(true)
+    , mThread(&SaveGameWriter::run, this)
+{
+}
+
+/**
+ * Destructor of SaveGameWriter class. The background thread finishes the pending write before it stops, so a save
+ * made right before quitting is not lost.
+ */
+SaveGameWriter::~SaveGameWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mRunning = false;
+  }
+  mCondition.notify_one();
+  mThread.join();
+}
+
+/**
+ * Hand a save over to be written into a file in the background. The save is swapped with the buffer of the previous
+ * save, so the caller can write the next save into it without allocating.
+ * @param save a SaveGame object indicates the save, it holds the previous save afterwards.
+ * @param filename a std::string indicates the path of the file.
+ * @return a bool value indicates whether the save was taken, false while the last one is still being written.
+ */
+bool SaveGameWriter::write(SaveGame& save, const std::string& filename)
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mIsWriting)
+      return false;
+
+    mSave.swap(save);
+    mFilename = filename;
+    mIsWriting = true;
+  }
+  mCondition.notify_one();
+  return true;
+}
+
+/**
+ * Check whether a save is still being written.
+ * @return a bool value indicates whether the background thread is busy.
+ */
+bool SaveGameWriter::isWriting()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mIsWriting;
+}
+
+/**
+ * Main loop of the background thread, write each save handed over until we are asked to stop. The save is not
+ * touched by the main thread while mIsWriting is set, so it is written without holding the lock.
+ */
+void SaveGameWriter::run()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  while (true)
+  {
+    // Sleep until there is something to write or we have to stop.
+    mCondition.wait(lock, [this] () { return mIsWriting || !mRunning; });
+
+    if (!mIsWriting)
+      break;
+
+    const std::string filename = mFilename;
+    const std::string temporary = filename + ".tmp";
+    lock.unlock();
+    try
+    {
+      mSave.saveToFile(temporary);
+      // Replace the previous save in one step, so a crash leaves either the old or the new save behind.
+#ifdef _WIN32
+      if (!MoveFileExA(temporary.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+#else
+      if (std::rename(temporary.c_str(), filename.c_str()) != 0)
+#endif
+        throw std::runtime_error("SaveGameWriter::run - Failed to rename " + temporary);
+    }
+    catch (std::exception& e)
+    {
+      // Nobody waits for the write, so the failure is only reported.
+      std::cerr << "\nEXCEPTION: " << e.what() << std::endl;
+    }
+    lock.lock();
+    mIsWriting = false;
+  }
+}
@@ -13,6 +13,7 @@
 SceneNode::SceneNode()
     : mChildren()
     , mParent(nullptr)
+    , mIsMarkedForRemoval(false)
 {
 }
 
@@ -28,6 +29,15 @@ void SceneNode::attachChild(Ptr child)
   mChildren.push_back(std::move(child));
 }
 
+/**
+ * Reserve room for children, so that attaching up to that many children never reallocates the children vector.
+ * @param count a std::size_t indicates how many children the node is going to hold at most.
+ */
+void SceneNode::reserveChildren(std::size_t count)
+{
+  mChildren.reserve(count);
+}
+
 /**
  * Try to get and remove one specific child SceneNode object from the current SceneNode object.
  * @param node indicates the specific node we want to get and remove.
@@ -77,6 +87,105 @@ void SceneNode::updateChildren(sf::Time dt)
     child -> update(dt);
 }
 
+/**
+ * Flag current SceneNode for removal. Nothing is detached yet, so this is safe during update and while iterating
+ * collision pairs. The node and its children are removed by the next removeWrecks() on one of its ancestors.
+ */
+void SceneNode::destroy()
+{
+  mIsMarkedForRemoval = true;
+}
+
+/**
+ * Check whether current SceneNode is flagged for removal.
+ * @return a bool value indicates whether the node is going to be removed.
+ */
+bool SceneNode::isMarkedForRemoval() const
+{
+  return mIsMarkedForRemoval;
+}
+
+/**
+ * Move every flagged node of the subtree out of the graph. Each node compacts its children vector in a single
+ * pass, so removing many nodes costs the same as removing one, unlike calling detachChild() for each of them.
+ * The removed nodes are not destroyed here but handed over, so that the caller can handle all of them at once.
+ * @param wrecks a vector receiving the removed nodes(together with their children).
+ */
+void SceneNode::removeWrecks(std::vector<Ptr>& wrecks)
+{
+  std::size_t kept = 0;
+  for (std::size_t i = 0; i < mChildren.size(); ++i)
+  {
+    if (mChildren[i] -> mIsMarkedForRemoval)
+    {
+      mChildren[i] -> mParent = nullptr;
+      wrecks.push_back(std::move(mChildren[i]));
+    }
+    else
+    {
+      // Keep the order of the remaining children(it is their drawing order).
+      if (kept != i)
+        mChildren[kept] = std::move(mChildren[i]);
+      ++kept;
+    }
+  }
+  mChildren.erase(mChildren.begin() + kept, mChildren.end());
+
+  for (Ptr& child : mChildren)
+    child -> removeWrecks(wrecks);
+}
+
+/**
+ * Add the collision bodies of current SceneNode and all its children objects.
+ * @param collisions a CollisionSystem object indicates where the bodies are added.
+ */
+void SceneNode::collectBodies(CollisionSystem& collisions)
+{
+  collectCurrentBodies(collisions);
+
+  for (Ptr& child : mChildren)
+    child -> collectBodies(collisions);
+}
+
+void SceneNode::collectCurrentBodies(CollisionSystem&)
+{
+  // No collision bodies by default
+}
+
+/**
+ * Add the simulation state of current SceneNode and all its children objects to a checksum, in scene graph order.
+ * @param hash a StateHash object indicates the checksum.
+ */
+void SceneNode::hashState(StateHash& hash)
+{
+  hashCurrentState(hash);
+
+  for (Ptr& child : mChildren)
+    child -> hashState(hash);
+}
+
+void SceneNode::hashCurrentState(StateHash&)
+{
+  // No simulation state by default
+}
+
+/**
+ * Write the visible state of current SceneNode and all its children objects into a snapshot, in scene graph order.
+ * @param snapshot a Snapshot object indicates where the state is written to.
+ */
+void SceneNode::writeSnapshot(Snapshot& snapshot)
+{
+  writeCurrentSnapshot(snapshot);
+
+  for (Ptr& child : mChildren)
+    child -> writeSnapshot(snapshot);
+}
+
+void SceneNode::writeCurrentSnapshot(Snapshot&)
+{
+  // Nothing visible by default
+}
+
 /**
  * Override from sf::Drawable to draw the object to a render target.
  * @param target indicates the sf::RenderTarget object we want to draw to
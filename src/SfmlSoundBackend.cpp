@@ -0,0 +1,91 @@
+// Include project header files
+#include "SfmlSoundBackend.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Audio/Listener.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+// Include C++ standard headers.
+#include <cassert>
+#include <cmath>
+
+namespace
+{
+  // The listener floats above the 2D world, so that sounds right under it are not all heard at full volume.
+  const float ListenerZ = 300.f;
+  // How fast sounds get quieter with distance.
+  const float Attenuation = 8.f;
+  // Distance in the world plane at which sounds start getting quieter.
+  const float MinDistance2D = 200.f;
+  const float MinDistance3D = std::sqrt(MinDistance2D * MinDistance2D + ListenerZ * ListenerZ);
+}
+
+/**
+ * Constructor of SfmlSoundBackend class.
+ * @param voiceCount a std::size_t indicates how many sounds can play at the same time.
+ */
+SfmlSoundBackend::SfmlSoundBackend(std::size_t voiceCount)
+    : mVoices(voiceCount)
+{
+  for (sf::Sound& voice : mVoices)
+  {
+    voice.setAttenuation(Attenuation);
+    voice.setMinDistance(MinDistance3D);
+  }
+}
+
+/**
+ * Get the number of voices.
+ * @return a std::size_t indicates how many sounds can play at the same time.
+ */
+std::size_t SfmlSoundBackend::getVoiceCount() const
+{
+  return mVoices.size();
+}
+
+/**
+ * Start playing a sound buffer on a voice at a world position.
+ * @param voice a std::size_t indicates the index of the voice.
+ * @param buffer a sf::SoundBuffer object indicates the samples to play.
+ * @param position a sf::Vector2f indicates the world position of the sound.
+ */
+void SfmlSoundBackend::play(std::size_t voice, const sf::SoundBuffer& buffer, sf::Vector2f position)
+{
+  assert(voice < mVoices.size());
+
+  sf::Sound& sound = mVoices[voice];
+  sound.setBuffer(buffer);
+  // The world's y axis points down, OpenAL's points up.
+  sound.setPosition(position.x, -position.y, 0.f);
+  sound.play();
+}
+
+/**
+ * Stop a voice.
+ * @param voice a std::size_t indicates the index of the voice.
+ */
+void SfmlSoundBackend::stop(std::size_t voice)
+{
+  assert(voice < mVoices.size());
+  mVoices[voice].stop();
+}
+
+/**
+ * Check whether a voice is still playing.
+ * @param voice a std::size_t indicates the index of the voice.
+ * @return a bool value indicates whether the voice is busy.
+ */
+bool SfmlSoundBackend::isPlaying(std::size_t voice) const
+{
+  assert(voice < mVoices.size());
+  return mVoices[voice].getStatus() == sf::Sound::Playing;
+}
+
+/**
+ * Move the listener to a world position.
+ * @param position a sf::Vector2f indicates the world position of the listener.
+ */
+void SfmlSoundBackend::setListenerPosition(sf::Vector2f position)
+{
+  sf::Listener::setPosition(position.x, -position.y, ListenerZ);
+}
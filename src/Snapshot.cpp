@@ -0,0 +1,253 @@
+// Include project header files
+#include "Snapshot.hpp"
+#include "NetworkProtocol.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Network/Packet.hpp>
+
+// Include C++ standard headers.
+#include <cmath>
+
+namespace
+{
+  // Every object takes at least three bytes, so a snapshot never carries more objects than this.
+  const std::uint32_t MaxObjects = Network::MaxFragments * Network::FragmentSize / 3;
+
+  /**
+   * Quantize a coordinate to steps of 1/Precision pixels.
+   * @param value a float indicates the coordinate.
+   * @return a 32-bit integer indicates the quantized coordinate.
+   */
+  std::int32_t quantize(float value)
+  {
+    return static_cast<std::int32_t>(std::lround(value * Snapshot::Precision));
+  }
+
+  /**
+   * Write an unsigned integer with 7 bits per byte, the high bit of a byte tells whether another byte follows.
+   * @param packet a sf::Packet object indicates where the integer is written to.
+   * @param value a 32-bit integer indicates the value.
+   */
+  void writeVarint(sf::Packet& packet, std::uint32_t value)
+  {
+    while (value >= 0x80)
+    {
+      packet << static_cast<sf::Uint8>(value | 0x80);
+      value >>= 7;
+    }
+    packet << static_cast<sf::Uint8>(value);
+  }
+
+  /**
+   * Read an unsigned integer written by writeVarint().
+   * @param packet a sf::Packet object indicates where the integer is read from.
+   * @param value a 32-bit integer receiving the value.
+   * @return a bool value indicates whether the integer was complete.
+   */
+  bool readVarint(sf::Packet& packet, std::uint32_t& value)
+  {
+    value = 0;
+    for (int shift = 0; shift < 35; shift += 7)
+    {
+      sf::Uint8 byte;
+      if (!(packet >> byte))
+        return false;
+
+      value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80))
+        return true;
+    }
+    return false;
+  }
+
+  /**
+   * Write the difference between a value and its baseline, small differences of either sign take few bytes.
+   * @param packet a sf::Packet object indicates where the difference is written to.
+   * @param value a 32-bit integer indicates the value.
+   * @param baseline a 32-bit integer indicates the value in the baseline.
+   */
+  void writeDelta(sf::Packet& packet, std::int32_t value, std::int32_t baseline)
+  {
+    // Zigzag encoding maps 0, -1, 1, -2, ... to 0, 1, 2, 3, ...
+    std::uint32_t delta = static_cast<std::uint32_t>(value) - static_cast<std::uint32_t>(baseline);
+    writeVarint(packet, (delta << 1) ^ (0u - (delta >> 31)));
+  }
+
+  /**
+   * Read a value written by writeDelta().
+   * @param packet a sf::Packet object indicates where the difference is read from.
+   * @param value a 32-bit integer receiving the value.
+   * @param baseline a 32-bit integer indicates the value in the baseline.
+   * @return a bool value indicates whether the difference was complete.
+   */
+  bool readDelta(sf::Packet& packet, std::int32_t& value, std::int32_t baseline)
+  {
+    std::uint32_t zigzag;
+    if (!readVarint(packet, zigzag))
+      return false;
+
+    std::uint32_t delta = (zigzag >> 1) ^ (0u - (zigzag & 1));
+    value = static_cast<std::int32_t>(static_cast<std::uint32_t>(baseline) + delta);
+    return true;
+  }
+}
+
+/**
+ * Constructor of an empty Snapshot class.
+ */
+Snapshot::Snapshot()
+    : mTick(NoTick)
+    , mViewX(0)
+    , mViewY(0)
+    , mObjects()
+{
+}
+
+/**
+ * Set the tick of the snapshot.
+ * @param tick a 32-bit integer indicates the tick of the world.
+ */
+void Snapshot::setTick(std::uint32_t tick)
+{
+  mTick = tick;
+}
+
+/**
+ * Get the tick of the snapshot.
+ * @return a 32-bit integer indicates the tick of the world, NoTick if the snapshot holds nothing.
+ */
+std::uint32_t Snapshot::getTick() const
+{
+  return mTick;
+}
+
+/**
+ * Remove every object and set the view center.
+ * @param viewCenter a sf::Vector2f indicates the center of the view.
+ */
+void Snapshot::clear(sf::Vector2f viewCenter)
+{
+  mViewX = quantize(viewCenter.x);
+  mViewY = quantize(viewCenter.y);
+  mObjects.clear();
+}
+
+/**
+ * Reserve room for objects, so that adding up to that many never reallocates.
+ * @param count a std::size_t indicates the number of objects.
+ */
+void Snapshot::reserve(std::size_t count)
+{
+  mObjects.reserve(count);
+}
+
+/**
+ * Add one object.
+ * @param category an unsigned int indicates the category of the object.
+ * @param position a sf::Vector2f indicates the world position of the object.
+ */
+void Snapshot::addObject(unsigned int category, sf::Vector2f position)
+{
+  Object object = { category, quantize(position.x), quantize(position.y) };
+  mObjects.push_back(object);
+}
+
+/**
+ * Get the view center.
+ * @return a sf::Vector2f indicates the center of the view.
+ */
+sf::Vector2f Snapshot::getViewCenter() const
+{
+  return sf::Vector2f(static_cast<float>(mViewX) / Precision, static_cast<float>(mViewY) / Precision);
+}
+
+/**
+ * Get the number of objects.
+ * @return a std::size_t indicates the number of objects.
+ */
+std::size_t Snapshot::getObjectCount() const
+{
+  return mObjects.size();
+}
+
+/**
+ * Get the category of one object.
+ * @param index a std::size_t indicates the index of the object.
+ * @return an unsigned int indicates the category.
+ */
+unsigned int Snapshot::getCategory(std::size_t index) const
+{
+  return mObjects[index].category;
+}
+
+/**
+ * Get the position of one object.
+ * @param index a std::size_t indicates the index of the object.
+ * @return a sf::Vector2f indicates the world position.
+ */
+sf::Vector2f Snapshot::getPosition(std::size_t index) const
+{
+  return sf::Vector2f(static_cast<float>(mObjects[index].x) / Precision,
+                      static_cast<float>(mObjects[index].y) / Precision);
+}
+
+/**
+ * Write the view and the objects as a delta against a baseline. Objects beyond the end of the baseline are written
+ * against zero, so a full snapshot is a delta against an empty one.
+ * @param packet a sf::Packet object indicates where the snapshot is written to.
+ * @param baseline a pointer to the snapshot the reader already has, nullptr to write the snapshot in full.
+ */
+void Snapshot::write(sf::Packet& packet, const Snapshot* baseline) const
+{
+  static const Snapshot Empty;
+  if (!baseline)
+    baseline = &Empty;
+
+  writeDelta(packet, mViewX, baseline -> mViewX);
+  writeDelta(packet, mViewY, baseline -> mViewY);
+  writeVarint(packet, static_cast<std::uint32_t>(mObjects.size()));
+
+  static const Object Zero = { 0, 0, 0 };
+  for (std::size_t i = 0; i < mObjects.size(); ++i)
+  {
+    const Object& object = mObjects[i];
+    const Object& previous = i < baseline -> mObjects.size() ? baseline -> mObjects[i] : Zero;
+    // Categories rarely change at an index, so they are sent as the bits which differ.
+    writeVarint(packet, object.category ^ previous.category);
+    writeDelta(packet, object.x, previous.x);
+    writeDelta(packet, object.y, previous.y);
+  }
+}
+
+/**
+ * Read the view and the objects written by write() against the same baseline. The snapshot must not be the
+ * baseline itself.
+ * @param packet a sf::Packet object indicates where the snapshot is read from.
+ * @param baseline a pointer to the snapshot the writer used, nullptr if it was written in full.
+ * @return a bool value indicates whether the snapshot was read completely.
+ */
+bool Snapshot::read(sf::Packet& packet, const Snapshot* baseline)
+{
+  static const Snapshot Empty;
+  if (!baseline)
+    baseline = &Empty;
+
+  std::uint32_t count;
+  if (!readDelta(packet, mViewX, baseline -> mViewX) || !readDelta(packet, mViewY, baseline -> mViewY)
+      || !readVarint(packet, count) || count > MaxObjects)
+    return false;
+
+  mObjects.resize(count);
+  static const Object Zero = { 0, 0, 0 };
+  for (std::size_t i = 0; i < mObjects.size(); ++i)
+  {
+    Object& object = mObjects[i];
+    const Object& previous = i < baseline -> mObjects.size() ? baseline -> mObjects[i] : Zero;
+    std::uint32_t category;
+    if (!readVarint(packet, category) || !readDelta(packet, object.x, previous.x)
+        || !readDelta(packet, object.y, previous.y))
+      return false;
+    object.category = category ^ previous.category;
+  }
+  return true;
+}
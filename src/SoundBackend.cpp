@@ -0,0 +1,5 @@
+// Include project header files
+#include "SoundBackend.hpp"
+
+// Set virtual destructor of SoundBackend class to default.
+SoundBackend::~SoundBackend() = default;
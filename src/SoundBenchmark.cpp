@@ -0,0 +1,81 @@
+// Include project header files
+#include "SoundBenchmark.hpp"
+#include "SoundPlayer.hpp"
+#include "SoundSynthesizer.hpp"
+#include "NullSoundBackend.hpp"
+#include "ResourceHolder.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+
+// Include C++ standard headers.
+#include <random>
+
+namespace
+{
+  // Fewer voices than the game has, so the battle needs more voices than there are.
+  const std::size_t SoundVoiceCount = 8;
+  // The battle runs in real time(voices stay busy for the duration of their buffer) for this many frames.
+  const std::size_t FrameCount = 180;
+  const sf::Time TimePerFrame = sf::seconds(1.f / 60.f);
+  // Requests per frame: enemy rings all over the battlefield, the player's gunfire next to the listener, and
+  // an explosion every ExplosionInterval frames.
+  const int EnemyGunfirePerFrame = 16;
+  const int AlliedGunfirePerFrame = 2;
+  const std::size_t ExplosionInterval = 15;
+  // Half the edge length of the square the enemy gunfire is spread over, well beyond the hearing distance.
+  const float BattlefieldRadius = 1200.f;
+  // Time the player thread gets to handle the last requests.
+  const sf::Time DrainTime = sf::milliseconds(50);
+}
+
+/**
+ * Run the battle around a listener at the origin and write how the requests were handled.
+ * @param out a std::ostream object indicates where the results are written to.
+ */
+void SoundBenchmark::run(std::ostream& out)
+{
+  SoundHolder soundBuffers;
+  SoundPlayer sounds(SoundSynthesizer::synthesizeAll(soundBuffers),
+                     SoundBackend::Ptr(new NullSoundBackend(SoundVoiceCount)));
+  sounds.setListenerPosition(sf::Vector2f(0.f, 0.f));
+
+  std::mt19937 random(42);
+  std::uniform_real_distribution<float> battlefield(-BattlefieldRadius, BattlefieldRadius);
+  std::uniform_real_distribution<float> nearby(-50.f, 50.f);
+
+  std::size_t requests = 0;
+  sf::Time requestTime = sf::Time::Zero;
+  for (std::size_t frame = 0; frame < FrameCount; ++frame)
+  {
+    sf::Clock clock;
+    for (int i = 0; i < EnemyGunfirePerFrame; ++i)
+    {
+      sf::Vector2f position(battlefield(random), battlefield(random));
+      sounds.play(SoundEffect::EnemyGunfire, position, SoundPlayer::getPriority(SoundEffect::EnemyGunfire));
+    }
+    for (int i = 0; i < AlliedGunfirePerFrame; ++i)
+    {
+      sf::Vector2f position(nearby(random), nearby(random));
+      sounds.play(SoundEffect::AlliedGunfire, position, SoundPlayer::getPriority(SoundEffect::AlliedGunfire));
+    }
+    requests += EnemyGunfirePerFrame + AlliedGunfirePerFrame;
+    if (frame % ExplosionInterval == 0)
+    {
+      sf::Vector2f position(nearby(random), nearby(random));
+      sounds.play(SoundEffect::Explosion, position, SoundPlayer::getPriority(SoundEffect::Explosion));
+      ++requests;
+    }
+    requestTime += clock.getElapsedTime();
+
+    sf::sleep(TimePerFrame - clock.getElapsedTime());
+  }
+  sf::sleep(DrainTime);
+
+  SoundPlayer::Counters counters = sounds.getCounters();
+  out << requests << " requests on " << SoundVoiceCount << " voices: " << counters.played << " played, "
+      << counters.culled << " culled, " << counters.stolen << " stolen, " << counters.dropped << " dropped, "
+      << requestTime.asMicroseconds() * 1000.0 / requests << " ns per request" << std::endl;
+}
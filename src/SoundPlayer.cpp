@@ -0,0 +1,238 @@
+// Include project header files
+#include "SoundPlayer.hpp"
+#include "ResourceHolder.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/System/Sleep.hpp>
+
+// Include C++ standard headers.
+#include <algorithm>
+
+// A bit more than the diagonal of the view, sounds beyond that are far off screen.
+const float SoundPlayer::DefaultHearingDistance = 800.f;
+// Drain the queue 200 times per second, well below the length of any sound effect.
+const sf::Time SoundPlayer::UpdateInterval = sf::milliseconds(5);
+
+/**
+ * Default constructor of SoundRequest struct.
+ */
+SoundRequest::SoundRequest()
+    : type(Play)
+    , effect(SoundEffect::AlliedGunfire)
+    , position()
+    , priority(0)
+{
+}
+
+/**
+ * Constructor of SoundRequest struct.
+ * @param type an enum indicates what the request asks for.
+ * @param effect an enum indicates the sound effect to play.
+ * @param position a sf::Vector2f indicates the world position of the sound or of the listener.
+ * @param priority an int indicates the priority of the sound.
+ */
+SoundRequest::SoundRequest(Type type, SoundEffect::ID effect, sf::Vector2f position, int priority)
+    : type(type)
+    , effect(effect)
+    , position(position)
+    , priority(priority)
+{
+}
+
+/**
+ * Constructor of SoundPlayer class, start the player thread.
+ * @param sounds a SoundHolder object indicates the loaded sound buffers.
+ * @param backend a unique_ptr to the output the voices play on.
+ * @param hearingDistance a float indicates how far from the listener sounds are still played.
+ */
+SoundPlayer::SoundPlayer(const SoundHolder& sounds, SoundBackend::Ptr backend, float hearingDistance)
+    : mSounds(sounds)
+    , mBackend(std::move(backend))
+    , mHearingDistance(hearingDistance)
+    , mVoicePriorities(mBackend -> getVoiceCount(), 0)
+    , mBatch()
+    , mListenerPosition()
+    , mQueue()
+    , mPlayed(0)
+    , mCulled(0)
+    , mStolen(0)
+    , mDropped(0)
+    , mRunning(true)
+    , mThread()
+{
+  // Reserve the whole batch up front, so the player thread never allocates.
+  mBatch.reserve(QueueCapacity);
+  mThread = std::thread(&SoundPlayer::run, this);
+}
+
+/**
+ * Destructor of SoundPlayer class, stop the player thread.
+ */
+SoundPlayer::~SoundPlayer()
+{
+  mRunning = false;
+  mThread.join();
+}
+
+/**
+ * Request a sound effect at a world position, must always be called from the same thread. Never blocks.
+ * @param effect an enum indicates the sound effect to play.
+ * @param position a sf::Vector2f indicates the world position of the sound.
+ * @param priority an int indicates the priority of the sound(higher wins).
+ * @return a bool value indicates whether the request was queued(false if the queue is full).
+ */
+bool SoundPlayer::play(SoundEffect::ID effect, sf::Vector2f position, int priority)
+{
+  if (mQueue.push(SoundRequest(SoundRequest::Play, effect, position, priority)))
+    return true;
+
+  ++mDropped;
+  return false;
+}
+
+/**
+ * Move the listener to a world position, must be called from the same thread as play().
+ * @param position a sf::Vector2f indicates the world position of the listener.
+ */
+void SoundPlayer::setListenerPosition(sf::Vector2f position)
+{
+  // If the queue is full the listener simply moves with the next call.
+  mQueue.push(SoundRequest(SoundRequest::MoveListener, SoundEffect::AlliedGunfire, position, 0));
+}
+
+/**
+ * Get how the requests were handled so far.
+ * @return a Counters struct indicates the number of played, culled, stolen and dropped sounds.
+ */
+SoundPlayer::Counters SoundPlayer::getCounters() const
+{
+  Counters counters;
+  counters.played = mPlayed;
+  counters.culled = mCulled;
+  counters.stolen = mStolen;
+  counters.dropped = mDropped;
+  return counters;
+}
+
+/**
+ * Get the priority a sound effect is played with. Explosions are rare and matter most, the player's own gunfire
+ * comes next, and the rings of enemy gunfire, which fill the screen, give their voices up first.
+ * @param effect an enum indicates the sound effect.
+ * @return an int indicates the priority of the sound effect.
+ */
+int SoundPlayer::getPriority(SoundEffect::ID effect)
+{
+  switch (effect)
+  {
+    case SoundEffect::Explosion:
+      return 2;
+    case SoundEffect::AlliedGunfire:
+      return 1;
+
+    default:
+      return 0;
+  }
+}
+
+/**
+ * Main loop of the player thread.
+ */
+void SoundPlayer::run()
+{
+  while (mRunning)
+  {
+    processRequests();
+    sf::sleep(UpdateInterval);
+  }
+}
+
+/**
+ * Drain the request queue, drop the sounds too far from the listener and start the others in priority order,
+ * nearer sounds first among equal priorities.
+ */
+void SoundPlayer::processRequests()
+{
+  mBatch.clear();
+
+  SoundRequest request;
+  while (mBatch.size() < QueueCapacity && mQueue.pop(request))
+  {
+    if (request.type == SoundRequest::MoveListener)
+    {
+      mListenerPosition = request.position;
+      mBackend -> setListenerPosition(request.position);
+      continue;
+    }
+
+    sf::Vector2f offset = request.position - mListenerPosition;
+    if (offset.x * offset.x + offset.y * offset.y > mHearingDistance * mHearingDistance)
+    {
+      ++mCulled;
+      continue;
+    }
+    mBatch.push_back(request);
+  }
+
+  const sf::Vector2f listener = mListenerPosition;
+  std::sort(mBatch.begin(), mBatch.end(), [listener] (const SoundRequest& lhs, const SoundRequest& rhs)
+  {
+    if (lhs.priority != rhs.priority)
+      return lhs.priority > rhs.priority;
+
+    sf::Vector2f lhsOffset = lhs.position - listener;
+    sf::Vector2f rhsOffset = rhs.position - listener;
+    return lhsOffset.x * lhsOffset.x + lhsOffset.y * lhsOffset.y
+           < rhsOffset.x * rhsOffset.x + rhsOffset.y * rhsOffset.y;
+  });
+
+  for (const SoundRequest& sound : mBatch)
+    startSound(sound);
+}
+
+/**
+ * Start one sound on a free voice, or on the voice of the lowest priority sound below its own.
+ * @param request a SoundRequest indicates the sound to start.
+ */
+void SoundPlayer::startSound(const SoundRequest& request)
+{
+  const std::size_t voiceCount = mVoicePriorities.size();
+  std::size_t voice = voiceCount;
+
+  // Take a free voice if there is one.
+  for (std::size_t i = 0; i < voiceCount; ++i)
+  {
+    if (!mBackend -> isPlaying(i))
+    {
+      voice = i;
+      break;
+    }
+  }
+
+  // Otherwise take the voice of the lowest priority sound, if that is below the request's priority.
+  if (voice == voiceCount)
+  {
+    int lowestPriority = request.priority;
+    for (std::size_t i = 0; i < voiceCount; ++i)
+    {
+      if (mVoicePriorities[i] < lowestPriority)
+      {
+        lowestPriority = mVoicePriorities[i];
+        voice = i;
+      }
+    }
+
+    if (voice == voiceCount)
+    {
+      ++mDropped;
+      return;
+    }
+
+    mBackend -> stop(voice);
+    ++mStolen;
+  }
+
+  mBackend -> play(voice, mSounds.get(request.effect), request.position);
+  mVoicePriorities[voice] = request.priority;
+  ++mPlayed;
+}
@@ -0,0 +1,95 @@
+// Include project header files
+#include "SoundSynthesizer.hpp"
+#include "ResourceHolder.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Audio/SoundBuffer.hpp>
+
+// Include C++ standard headers.
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+  // A struct indicates how one sound effect is synthesized.
+  struct SynthesisData
+  {
+    float		duration;
+    // The tone sweeps from the start to the end frequency(in Hz).
+    float		startFrequency;
+    float		endFrequency;
+    // Share of the noise in the mix(0 is a pure tone, 1 pure noise).
+    float		noise;
+    // Peak amplitude(1 is full scale).
+    float		volume;
+  };
+
+  // Synthesis of each sound effect, indexed by SoundEffect::ID.
+  const SynthesisData Table[SoundEffect::EffectCount] =
+  {
+    // Allied gunfire is a short high chirp.
+    { 0.08f, 1400.f, 500.f, 0.2f, 0.4f },
+    // Enemy gunfire is a lower and longer chirp.
+    { 0.15f, 700.f, 250.f, 0.3f, 0.3f },
+    // An explosion is a long rumble of noise.
+    { 0.8f, 120.f, 40.f, 0.85f, 0.9f },
+  };
+
+  const unsigned int SampleRate = 22050;
+  const float Pi = 3.14159265f;
+  // Weight of the newest sample in the low pass which softens the noise.
+  const float NoiseSmoothing = 0.2f;
+}
+
+/**
+ * Synthesize the buffer of every sound effect into a holder.
+ * @param sounds a SoundHolder object indicates the holder receiving the buffers.
+ * @return a reference to the holder.
+ */
+SoundHolder& SoundSynthesizer::synthesizeAll(SoundHolder& sounds)
+{
+  for (int i = 0; i < SoundEffect::EffectCount; ++i)
+  {
+    SoundEffect::ID effect = static_cast<SoundEffect::ID>(i);
+    sounds.insertResource(effect, synthesize(effect));
+  }
+  return sounds;
+}
+
+/**
+ * Synthesize the buffer of one sound effect: a sine sweep and low-passed noise, faded out quadratically.
+ * @param effect an enum indicates the sound effect.
+ * @return a unique_ptr to the sound buffer.
+ */
+std::unique_ptr<sf::SoundBuffer> SoundSynthesizer::synthesize(SoundEffect::ID effect)
+{
+  assert(effect < SoundEffect::EffectCount);
+  const SynthesisData& data = Table[effect];
+
+  const std::size_t sampleCount = static_cast<std::size_t>(data.duration * SampleRate);
+  std::vector<sf::Int16> samples(sampleCount);
+  std::minstd_rand random(static_cast<unsigned int>(effect) + 1);
+  std::uniform_real_distribution<float> noiseDistribution(-1.f, 1.f);
+
+  float phase = 0.f;
+  float noise = 0.f;
+  for (std::size_t i = 0; i < sampleCount; ++i)
+  {
+    const float progress = static_cast<float>(i) / sampleCount;
+    const float frequency = data.startFrequency + (data.endFrequency - data.startFrequency) * progress;
+    phase += 2.f * Pi * frequency / SampleRate;
+    noise += NoiseSmoothing * (noiseDistribution(random) - noise);
+
+    const float envelope = (1.f - progress) * (1.f - progress);
+    const float value = (1.f - data.noise) * std::sin(phase) + data.noise * noise;
+    samples[i] = static_cast<sf::Int16>(32767.f * data.volume * envelope * value);
+  }
+
+  std::unique_ptr<sf::SoundBuffer> buffer(new sf::SoundBuffer());
+  if (!buffer -> loadFromSamples(samples.data(), samples.size(), 1, SampleRate))
+    throw std::runtime_error("SoundSynthesizer::synthesize - Failed to create a sound buffer");
+  return buffer;
+}
@@ -8,12 +8,19 @@
  * @param textures
  * @param fonts
  * @param player
+ * @param glyphs
+ * @param sounds
+ * @param governor
  */
-State::Context::Context(sf::RenderWindow& window, TextureHolder& textures, FontHolder& fonts, Player& player)
+State::Context::Context(sf::RenderWindow& window, TextureHolder& textures, FontHolder& fonts, Player& player,
+                        GlyphCache& glyphs, SoundPlayer& sounds, const FrameGovernor& governor)
     : window(&window)
     , textures(&textures)
     , fonts(&fonts)
     , player(&player)
+    , glyphs(&glyphs)
+    , sounds(&sounds)
+    , governor(&governor)
 {
 }
 
@@ -25,12 +32,64 @@ State::Context::Context(sf::RenderWindow& window, TextureHolder& textures, FontH
 State::State(StateStack& stack, Context context)
     : mStack(&stack)
     , mContext(context)
+    , mDirty(true)
 {
 }
 
 // Set virtual destructor of State class to default.
 State::~State()= default;
 
+/**
+ * Reset the state to how it looks after construction, called when a cached state is pushed again.
+ * Does nothing by default.
+ */
+void State::reset()
+{
+}
+
+/**
+ * Hand the state's own textures over before it is destroyed, so that they can be released on the main thread
+ * while the rest of the state is destroyed elsewhere. States own no textures by default.
+ */
+void State::releaseTextures(std::vector<std::unique_ptr<sf::Texture>>&)
+{
+}
+
+/**
+ * Check whether the states below this one stay frozen while it is on top. If so, the state stack draws them once
+ * and then reuses that frame until the stack changes.
+ * @return a bool value indicates whether the states below are frozen(false by default).
+ */
+bool State::freezesStatesBelow() const
+{
+  return false;
+}
+
+/**
+ * Check whether the state's output changed since it was last drawn.
+ * @return a bool value indicates whether the state has to be drawn again.
+ */
+bool State::isDirty() const
+{
+  return mDirty;
+}
+
+/**
+ * Remember that the state's current output has been drawn.
+ */
+void State::markClean()
+{
+  mDirty = false;
+}
+
+/**
+ * Tell the state stack that the state's output changed and has to be drawn again.
+ */
+void State::markDirty()
+{
+  mDirty = true;
+}
+
 /**
  * Push current state to the game state stack.
  * @param stateID an enum indicates pushed state's id.
@@ -56,6 +115,15 @@ void State::requestStateClear()
   mStack -> clearStates();
 }
 
+/**
+ * Construct a game state in the background which is likely to be pushed next.
+ * @param stateID an enum indicates the state's id.
+ */
+void State::requestStatePrewarm(States::ID stateID)
+{
+  mStack -> prewarmState(stateID);
+}
+
 /**
  * Get current state object's Context member.
  * @return a Context struct indicates a holder of shared objects between all states of the game.
@@ -0,0 +1,222 @@
+// Include project header files
+#include "StateBenchmark.hpp"
+#include "StateStack.hpp"
+#include "StaticStateStack.hpp"
+#include "GameState.hpp"
+#include "AllocationTracker.hpp"
+#include "FrameGovernor.hpp"
+#include "ResourceHolder.hpp"
+#include "Player.hpp"
+#include "GlyphCache.hpp"
+#include "SoundPlayer.hpp"
+#include "NullSoundBackend.hpp"
+#include "SoundSynthesizer.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/System/Clock.hpp>
+
+namespace
+{
+  // Every stack is measured for at least this long and at least MinRuns times.
+  const sf::Time MinDuration = sf::seconds(1.f);
+  const std::size_t MinRuns = 3;
+  // Number of sequences in one run.
+  const std::size_t SequencesPerRun = 10000;
+  // Number of stack calls in one sequence(2 pushes, 2 pops, 3 updates, 2 events and 1 draw).
+  const std::size_t CallsPerSequence = 10;
+  // The states play nothing worth hearing, one voice is enough.
+  const std::size_t SoundVoiceCount = 1;
+  // Number of game states built and removed each way, every one of them loads a whole world.
+  const std::size_t TeardownRounds = 10;
+
+  /**
+   * A state which does nothing, so only the stack is measured.
+   */
+  class TrivialState : public State
+  {
+   public:
+    TrivialState(StateStack& stack, Context context)
+        : State(stack, context)
+    {
+    }
+
+    virtual void draw()
+    {
+    }
+
+    virtual bool update(sf::Time)
+    {
+      return true;
+    }
+
+    virtual bool handleEvent(const sf::Event&)
+    {
+      return true;
+    }
+  };
+
+  // Both stacks know the same two state classes.
+  class BottomState : public TrivialState
+  {
+   public:
+    BottomState(StateStack& stack, Context context) : TrivialState(stack, context) {}
+  };
+
+  class TopState : public TrivialState
+  {
+   public:
+    TopState(StateStack& stack, Context context) : TrivialState(stack, context) {}
+  };
+
+  typedef StaticStateStack<2, StateBinding<States::Title, BottomState>, StateBinding<States::Menu, TopState>>
+      BenchmarkStaticStack;
+
+  /**
+   * Push two states, use them and pop them again. Changes requested through the stack are applied after the next
+   * update or event, just like during the game.
+   * @tparam Stack indicates the type of the stack
+   * @param stack indicates the stack the sequence is run on.
+   */
+  template <typename Stack>
+  void runSequence(Stack& stack)
+  {
+    const sf::Time dt = sf::seconds(1.f / 60.f);
+    sf::Event event;
+    event.type = sf::Event::GainedFocus;
+
+    stack.pushState(States::Title);
+    stack.update(dt);
+    stack.pushState(States::Menu);
+    stack.handleEvent(event);
+    stack.update(dt);
+    stack.draw();
+    stack.handleEvent(event);
+    stack.popState();
+    stack.popState();
+    stack.update(dt);
+  }
+
+  /**
+   * Run the sequence on one stack for at least MinDuration and write the time and the allocations per stack call.
+   * @tparam Stack indicates the type of the stack
+   * @param name indicates the name the result is written with.
+   * @param stack indicates the stack the sequence is run on.
+   * @param out a std::ostream object indicates where the result is written to.
+   */
+  template <typename Stack>
+  void measure(const char* name, Stack& stack, std::ostream& out)
+  {
+    // Warm up once, so the first constructions(and cached states) are not counted.
+    for (std::size_t i = 0; i < SequencesPerRun; ++i)
+      runSequence(stack);
+
+    std::size_t runs = 0;
+    sf::Time elapsed = sf::Time::Zero;
+    AllocationTracker::Counters before = AllocationTracker::getThreadCounters();
+    while (runs < MinRuns || elapsed < MinDuration)
+    {
+      sf::Clock clock;
+      for (std::size_t i = 0; i < SequencesPerRun; ++i)
+        runSequence(stack);
+      elapsed += clock.getElapsedTime();
+      ++runs;
+    }
+    AllocationTracker::Counters after = AllocationTracker::getThreadCounters();
+
+    const double calls = static_cast<double>(runs * SequencesPerRun * CallsPerSequence);
+    out << name << ": " << elapsed.asMicroseconds() * 1000.0 / calls << " ns/op, ";
+    if (AllocationTracker::isEnabled())
+      out << (after.allocations - before.allocations) / calls << " allocations/op";
+    else
+      out << "allocations not tracked(build with TRACK_ALLOCATIONS)";
+    out << std::endl;
+  }
+
+  /**
+   * Remove game states both ways and write the time the removing frame spends per state: destroyed in place, and
+   * evicted from the cache of a stack(which hands it over to the reclaimer). The textures of a reclaimed state are
+   * released by the next update, whose time is written as well.
+   * @param context indicates the shared objects the game states are built with.
+   * @param out a std::ostream object indicates where the result is written to.
+   */
+  void measureTeardown(State::Context context, std::ostream& out)
+  {
+    const sf::Time dt = sf::seconds(1.f / 60.f);
+    StateStack stack(context);
+    stack.registerState<GameState>(States::Game);
+
+    sf::Time inPlace = sf::Time::Zero;
+    sf::Time evicted = sf::Time::Zero;
+    sf::Time released = sf::Time::Zero;
+    for (std::size_t i = 0; i < TeardownRounds; ++i)
+    {
+      State::Ptr state(new GameState(stack, context));
+      sf::Clock clock;
+      state.reset();
+      inPlace += clock.getElapsedTime();
+
+      // A round is played and left, the game state stays cached until it is evicted.
+      stack.setCached(States::Game);
+      stack.pushState(States::Game);
+      stack.update(dt);
+      stack.clearStates();
+      stack.update(dt);
+      clock.restart();
+      stack.setCached(States::Game, false);
+      evicted += clock.getElapsedTime();
+      clock.restart();
+      stack.update(dt);
+      released += clock.getElapsedTime();
+    }
+
+    out << "GameState teardown: " << inPlace.asMicroseconds() / 1000.0 / TeardownRounds << " ms in place, "
+        << evicted.asMicroseconds() / 1000.0 / TeardownRounds << " ms evicted to the reclaimer(+"
+        << released.asMicroseconds() / 1000.0 / TeardownRounds << " ms releasing its textures next update)"
+        << std::endl;
+  }
+}
+
+/**
+ * Measure the factory StateStack, the factory StateStack with cached states and the StaticStateStack on the same
+ * sequence, then the teardown of a game state, and write the results.
+ * @param out a std::ostream object indicates where the results are written to.
+ */
+void StateBenchmark::run(std::ostream& out)
+{
+  // The trivial states never use the shared objects, and nothing freezes the window. The game states of the
+  // teardown need the sound buffers and the player.
+  sf::RenderWindow window;
+  TextureHolder textures;
+  FontHolder fonts;
+  Player player;
+  GlyphCache glyphs;
+  SoundHolder soundBuffers;
+  SoundPlayer sounds(SoundSynthesizer::synthesizeAll(soundBuffers),
+                     SoundBackend::Ptr(new NullSoundBackend(SoundVoiceCount)));
+  FrameGovernor governor(sf::seconds(1.f / 60.f), 1);
+  State::Context context(window, textures, fonts, player, glyphs, sounds, governor);
+
+  {
+    StateStack stack(context);
+    stack.registerState<BottomState>(States::Title);
+    stack.registerState<TopState>(States::Menu);
+    measure("StateStack", stack, out);
+  }
+  {
+    StateStack stack(context);
+    stack.registerState<BottomState>(States::Title);
+    stack.registerState<TopState>(States::Menu);
+    stack.setCached(States::Title);
+    stack.setCached(States::Menu);
+    measure("StateStack(cached)", stack, out);
+  }
+  {
+    BenchmarkStaticStack stack(context);
+    measure("StaticStateStack", stack, out);
+  }
+  measureTeardown(context, out);
+}
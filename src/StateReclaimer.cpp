@@ -0,0 +1,79 @@
+// Include project header files
+#include "StateReclaimer.hpp"
+
+// Include our Third-Party SFML header
+#include <SFML/Graphics/Texture.hpp>
+
+/**
+ * Constructor of StateReclaimer class, start the background thread.
+ */
+StateReclaimer::StateReclaimer()
+    : mTextures()
+    , mStates()
+    , mMutex()
+    , mCondition()
+    , mRunning(true)
+    , mThread(&StateReclaimer::run, this)
+{
+}
+
+/**
+ * Destructor of StateReclaimer class. The background thread destroys every state left before it stops,
+ * the remaining textures are then released here on the main thread.
+ */
+StateReclaimer::~StateReclaimer()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mRunning = false;
+  }
+  mCondition.notify_one();
+  mThread.join();
+}
+
+/**
+ * Hand a removed state over to be destroyed in the background. Its textures are taken back first, so that
+ * the background thread never touches OpenGL resources.
+ * @param state a unique_ptr to the removed game state.
+ */
+void StateReclaimer::reclaim(State::Ptr state)
+{
+  state -> releaseTextures(mTextures);
+
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStates.push_back(std::move(state));
+  }
+  mCondition.notify_one();
+}
+
+/**
+ * Release the textures of reclaimed states. Must be called from the main thread, whose context owns them.
+ */
+void StateReclaimer::releaseGraphicsResources()
+{
+  mTextures.clear();
+}
+
+/**
+ * Main loop of the background thread, destroy states one by one until we are asked to stop.
+ */
+void StateReclaimer::run()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  while (true)
+  {
+    // Sleep until there is something to destroy or we have to stop.
+    mCondition.wait(lock, [this] () { return !mStates.empty() || !mRunning; });
+
+    if (mStates.empty())
+      break;
+
+    // Take one state out and destroy it without holding the lock.
+    State::Ptr state = std::move(mStates.back());
+    mStates.pop_back();
+    lock.unlock();
+    state.reset();
+    lock.lock();
+  }
+}
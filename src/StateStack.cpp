@@ -1,8 +1,12 @@
 // Include project header files
 #include "StateStack.hpp"
+#include "Utility.hpp"
 
 // Include C++ standard headers.
 #include <cassert>
+#include <stdexcept>
+
+const std::size_t StateStack::MaxPendingChanges;
 
 /**
  * Constructor of StateStack class.
@@ -11,8 +15,16 @@
 StateStack::StateStack(State::Context context)
     : mStack()
     , mPendingList()
+    , mPendingCount(0)
     , mContext(context)
+    , mDirty(true)
+    , mFrozenFrame()
     , mFactories()
+    , mCachedIDs()
+    , mFrameRates()
+    , mCache()
+    , mPrewarmed()
+    , mReclaimer()
 {
 }
 
@@ -22,10 +34,13 @@ StateStack::StateStack(State::Context context)
  */
 void StateStack::update(sf::Time dt)
 {
+  // Release the textures of states removed during the previous ticks.
+  mReclaimer.releaseGraphicsResources();
+
   // Iterate from top to bottom, stop as soon as update() returns false
   for (auto itr = mStack.rbegin(); itr != mStack.rend(); ++itr)
   {
-    if (!(*itr) -> update(dt))
+    if (!itr -> state -> update(dt))
       break;
   }
   // Apply pending changes to the specific game state stack(game state push, pop or clear).
@@ -33,13 +48,61 @@ void StateStack::update(sf::Time dt)
 }
 
 /**
- * Draw each state one by one from the mStack.
+ * Draw each state one by one from the mStack. The states below the topmost pause-type state are only drawn once
+ * after the stack changed, later frames draw the frozen frame captured from them instead.
  */
 void StateStack::draw()
 {
-  // Draw all active states from bottom to top
-  for (State::Ptr& state : mStack)
-    state -> draw();
+  // Find the topmost state which freezes the states below it.
+  std::size_t firstLive = 0;
+  for (std::size_t i = mStack.size(); i > 0; --i)
+  {
+    if (mStack[i - 1].state -> freezesStatesBelow())
+    {
+      firstLive = i - 1;
+      break;
+    }
+  }
+
+  if (firstLive > 0)
+  {
+    if (mFrozenFrame.isValid())
+    {
+      mFrozenFrame.draw(*mContext.window);
+    }
+    else
+    {
+      for (std::size_t i = 0; i < firstLive; ++i)
+        mStack[i].state -> draw();
+      mFrozenFrame.capture(*mContext.window);
+    }
+  }
+
+  // Draw all live states from bottom to top
+  for (std::size_t i = firstLive; i < mStack.size(); ++i)
+    mStack[i].state -> draw();
+
+  for (StackEntry& entry : mStack)
+    entry.state -> markClean();
+  mDirty = false;
+}
+
+/**
+ * Check whether the stack or any state on it changed since the last draw. If not, the last drawn frame is still
+ * up to date and drawing can be skipped entirely.
+ * @return a bool value indicates whether the stack has to be drawn again.
+ */
+bool StateStack::isDirty() const
+{
+  if (mDirty)
+    return true;
+
+  for (const StackEntry& entry : mStack)
+  {
+    if (entry.state -> isDirty())
+      return true;
+  }
+  return false;
 }
 
 /**
@@ -52,7 +115,7 @@ void StateStack::handleEvent(const sf::Event& event)
   for (auto itr = mStack.rbegin(); itr != mStack.rend(); ++itr)
   {
     // Check if the specific state can handle that specific event.
-    if (!(*itr) -> handleEvent(event))
+    if (!itr -> state -> handleEvent(event))
       break;
   }
   // Apply pending changes to the specific game state stack(game state push, pop or clear).
@@ -65,7 +128,7 @@ void StateStack::handleEvent(const sf::Event& event)
  */
 void StateStack::pushState(States::ID stateID)
 {
-  mPendingList.emplace_back(PendingChange(Push, stateID));
+  addPendingChange(PendingChange(Push, stateID));
 }
 
 /**
@@ -73,7 +136,7 @@ void StateStack::pushState(States::ID stateID)
  */
 void StateStack::popState()
 {
-  mPendingList.emplace_back(PendingChange(Pop));
+  addPendingChange(PendingChange(Pop));
 }
 
 /**
@@ -81,7 +144,7 @@ void StateStack::popState()
  */
 void StateStack::clearStates()
 {
-  mPendingList.emplace_back(PendingChange(Clear));
+  addPendingChange(PendingChange(Clear));
 }
 
 /**
@@ -93,15 +156,102 @@ bool StateStack::isEmpty() const
   return mStack.empty();
 }
 
+/**
+ * Keep popped states of a specific ID alive so that the next push reuses them(after calling their reset hook)
+ * instead of constructing them again.
+ * @param stateID a enum indicates the game state id.
+ * @param cached a bool value indicates whether states of that ID are cached.
+ */
+void StateStack::setCached(States::ID stateID, bool cached)
+{
+  if (cached)
+    mCachedIDs.insert(stateID);
+  else
+  {
+    mCachedIDs.erase(stateID);
+    // Hand a state which was kept alive over to the reclaimer.
+    auto found = mCache.find(stateID);
+    if (found != mCache.end())
+    {
+      mReclaimer.reclaim(std::move(found -> second));
+      mCache.erase(found);
+    }
+  }
+}
+
+/**
+ * Construct a specific game state on a background thread so that a later push of it completes immediately.
+ * SFML gives each thread its own OpenGL context, so textures loaded by the state's constructor are usable
+ * from the main thread afterwards.
+ * @param stateID a enum indicates the game state id.
+ */
+void StateStack::prewarmState(States::ID stateID)
+{
+  // Nothing to do if that state is already cached or being constructed.
+  if (mCache.count(stateID) != 0 || mPrewarmed.count(stateID) != 0)
+    return;
+
+  // Pre-warming is only a hint, so a state which was never registered is simply ignored.
+  auto found = mFactories.find(stateID);
+  if (found == mFactories.end())
+    return;
+
+  mPrewarmed[stateID] = std::async(std::launch::async, found -> second);
+}
+
+/**
+ * Set the target frame rate while a specific game state is on top of the stack.
+ * @param stateID a enum indicates the game state id.
+ * @param framesPerSecond an unsigned int indicates the target frame rate, 0 means no limit.
+ */
+void StateStack::setFrameRate(States::ID stateID, unsigned int framesPerSecond)
+{
+  mFrameRates[stateID] = framesPerSecond;
+}
+
+/**
+ * Get the target frame rate of the state on top of the stack.
+ * @return an unsigned int indicates the target frame rate, 0 means no limit(also if the stack is empty).
+ */
+unsigned int StateStack::getFrameRate() const
+{
+  if (mStack.empty())
+    return 0;
+
+  auto found = mFrameRates.find(mStack.back().stateID);
+  return found != mFrameRates.end() ? found -> second : 0;
+}
+
 /**
  * Takes an ID of a state and returns a smart pointer to the corresponding state class.
- * First looking up the ID in the map and invoking the stored std::function factory,
+ * A cached state is reset and reused first, then a pre-warmed state is taken(waiting for its construction to
+ * finish if needed). Otherwise we look up the ID in the map and invoke the stored std::function factory,
  * which returns the std::unique_ptr to the State base class.
  * @param stateID a enum indicates the game state id.
  * @return a unique_ptr to the specific game state.
  */
 State::Ptr StateStack::createState(States::ID stateID)
 {
+  // Reuse a cached state.
+  auto cached = mCache.find(stateID);
+  if (cached != mCache.end())
+  {
+    State::Ptr state = std::move(cached -> second);
+    mCache.erase(cached);
+    state -> reset();
+    return state;
+  }
+
+  // Take a pre-warmed state.
+  auto prewarmed = mPrewarmed.find(stateID);
+  if (prewarmed != mPrewarmed.end())
+  {
+    // get() rethrows any exception thrown by the state's constructor.
+    State::Ptr state = prewarmed -> second.get();
+    mPrewarmed.erase(prewarmed);
+    return state;
+  }
+
   auto found = mFactories.find(stateID);
   // Ensure that we can find the state with specific id.
   assert(found != mFactories.end());
@@ -109,32 +259,80 @@ State::Ptr StateStack::createState(States::ID stateID)
   return found -> second();
 }
 
+/**
+ * Keep a removed state in the cache if its ID is cached, otherwise hand it over to the reclaimer which destroys
+ * it in the background instead of stalling the current frame.
+ * @param stateID a enum indicates the game state id.
+ * @param state a unique_ptr to the removed game state.
+ */
+void StateStack::releaseState(States::ID stateID, State::Ptr state)
+{
+  // Only one instance per ID is kept, any other one is destroyed.
+  if (mCachedIDs.count(stateID) != 0 && mCache.count(stateID) == 0)
+    mCache[stateID] = std::move(state);
+  else
+    mReclaimer.reclaim(std::move(state));
+}
+
 /**
  * Apply pending changes(game state push, pop or clear).
  */
 void StateStack::applyPendingChanges()
 {
   // Apply each pending change.
-  for (PendingChange change : mPendingList)
+  for (std::size_t i = 0; i < mPendingCount; ++i)
   {
+    const PendingChange& change = mPendingList[i];
     // Check the appending change type.
     switch (change.action)
     {
       case Push:
-        mStack.push_back(createState(change.stateID));
+        mStack.emplace_back(change.stateID, createState(change.stateID));
         break;
 
       case Pop:
+        releaseState(mStack.back().stateID, std::move(mStack.back().state));
         mStack.pop_back();
         break;
 
       case Clear:
+        for (StackEntry& entry : mStack)
+          releaseState(entry.stateID, std::move(entry.state));
         mStack.clear();
         break;
     }
   }
+  // Any change of the stack changes what is on screen(and what a frozen frame would show).
+  if (mPendingCount > 0)
+  {
+    mDirty = true;
+    mFrozenFrame.invalidate();
+  }
   // Clear the pending list.
-  mPendingList.clear();
+  mPendingCount = 0;
+}
+
+/**
+ * Add one pending change to the fixed-capacity pending buffer. More changes between two applies than the buffer can
+ * hold are a bug of the states requesting them, which fails in every build rather than overrunning the buffer.
+ * @param change a PendingChange object indicates the change to apply later.
+ */
+void StateStack::addPendingChange(const PendingChange& change)
+{
+  if (mPendingCount == MaxPendingChanges)
+    throw std::logic_error("StateStack::addPendingChange - More than " + toString(MaxPendingChanges) +
+                           " state changes were requested before they were applied");
+
+  mPendingList[mPendingCount++] = change;
+}
+
+/**
+ * Default constructor of PendingChange struct, used for unused entries of the pending buffer.
+ */
+StateStack::PendingChange::PendingChange()
+    : action(Clear)
+    , stateID(States::None)
+{
 }
 
 /**
@@ -146,4 +344,15 @@ StateStack::PendingChange::PendingChange(Action action, States::ID stateID)
     : action(action)
     , stateID(stateID)
 {
-}
\ No newline at end of file
+}
+
+/**
+ * Constructor of StackEntry struct.
+ * @param stateID an enum indicates the id of the game state.
+ * @param state a unique_ptr to the game state object.
+ */
+StateStack::StackEntry::StackEntry(States::ID stateID, State::Ptr state)
+    : stateID(stateID)
+    , state(std::move(state))
+{
+}
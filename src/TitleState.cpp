@@ -2,10 +2,25 @@
 #include "TitleState.hpp"
 #include "Utility.hpp"
 #include "ResourceHolder.hpp"
+#include "GlyphCache.hpp"
 
 // Include our Third-Party SFML header
 #include <SFML/Graphics/RenderWindow.hpp>
 
+// The prompt shown on the title screen.
+static const char* const PromptString = "Press any key to start";
+// Character size of the prompt(sf::Text's default).
+static const unsigned int PromptSize = 30;
+
+/**
+ * Declare the glyphs the title screen shows, so that they are rasterized at load time.
+ * @param glyphs a GlyphCache object collecting the declarations.
+ */
+void TitleState::declareGlyphs(GlyphCache& glyphs)
+{
+  glyphs.declare(Fonts::Main, PromptSize, PromptString);
+}
+
 /**
  * Constructor of TitleState class.
  * @param stack a StateStack object indicates the game state stack
@@ -22,7 +37,9 @@ TitleState::TitleState(StateStack& stack, Context context)
   // Set the text font.
   mText.setFont(context.fonts -> get(Fonts::Main));
   // Set the text string content.
-  mText.setString("Press any key to start");
+  mText.setString(PromptString);
+  mText.setCharacterSize(PromptSize);
+  context.glyphs -> check(mText);
   // Set title text's origin to be its center position.
   centerOrigin(mText);
   // Set the text position.
@@ -57,6 +74,8 @@ bool TitleState::update(sf::Time dt)
   {
     // Enable/Disable the display of the text.
     mShowText = !mShowText;
+    // The blink is the only change of the title screen.
+    markDirty();
     // Reset the text display time to be zero.
     mTextEffectTime = sf::Time::Zero;
   }
@@ -81,4 +100,4 @@ bool TitleState::handleEvent(const sf::Event& event)
   }
 
   return true;
-}
\ No newline at end of file
+}
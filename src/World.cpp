@@ -1,36 +1,136 @@
 // Include project header files
 #include "World.hpp"
+#include "StateHash.hpp"
+#include "Snapshot.hpp"
+#include "Player.hpp"
+#include "SaveGame.hpp"
 
 // Include our Third-Party SFML header
 #include <SFML/Graphics/RenderWindow.hpp>
 
 // Include C++ standard headers.
+#include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <stdexcept>
+
+// The level played by every world, compiled into the build directory next to the executable.
+static const char* const LevelPath = "Levels/Desert.level";
+// Most enemies room is reserved for up front, more of them allocate while the round is running.
+static const std::size_t MaxReservedEnemies = 1024;
+// The enemies of a spawn are created once its anchor is this close above the top of the view.
+static const float ActivationMargin = 100.f;
+// Active enemies are removed once they are this far below the bottom of the view.
+static const float RemovalMargin = 100.f;
+// Projectiles are removed once they are this far outside the view.
+static const float BattlefieldMargin = 100.f;
+// Maximum number of live projectiles.
+static const std::size_t MaxProjectiles = 65536;
+// Maximum number of live particles of each type, enough for a screen full of exploding enemy formations.
+static const std::size_t MaxParticles = 131072;
+// Exhaust particles spawned per second behind each aircraft, and their distance behind the aircraft's center.
+static const float ExhaustRate = 30.f;
+static const float ExhaustOffset = 30.f;
+// Enemies fire a ring of projectiles in every direction.
+static const float EnemyFireInterval = 1.2f;
+static const float EnemyProjectileSpeed = 150.f;
+static const int EnemyRingSize = 16;
+// Number of particles and fastest speed of an explosion.
+static const int ExplosionParticleCount = 48;
+static const float ExplosionSpeed = 120.f;
+static const float Pi = 3.14159265f;
+// Pi for the enemy ring directions, which are simulation state.
+static const double RingPi = 3.14159265358979323846;
+// Factor which keeps the speed of a diagonal movement.
+static const float InverseSqrt2 = 0.70710678f;
+// Number of background chunks kept at the same time, enough for the view plus one chunk ahead of it.
+static const std::size_t BackgroundChunkCount = 4;
+// While the cosmetic simulation is throttled, particles are integrated every this many ticks.
+static const std::size_t ThrottledParticleInterval = 2;
+// Horizontal distance between the aircraft of two players.
+static const float PlayerSpacing = 120.f;
 
 /**
  * Constructor of the World class.
  * @param window a sf::RenderWindow object indicates the window of the game.
+ * @param sounds a SoundPlayer object indicates the player of all sound effects.
+ * @param playerCount a std::size_t indicates the number of player aircraft.
+ */
+World::World(sf::RenderWindow& window, SoundPlayer& sounds, std::size_t playerCount)
+    : World(&window, window.getDefaultView(), sounds, playerCount)
+{
+}
+
+/**
+ * Constructor of a headless World class, e.g. the one of a server. It has no window and no background, so it is
+ * never drawn.
+ * @param viewSize a sf::Vector2f indicates the size of the view(the simulation depends on it).
+ * @param sounds a SoundPlayer object indicates the player of all sound effects.
+ */
+World::World(sf::Vector2f viewSize, SoundPlayer& sounds)
+    : World(nullptr, sf::View(viewSize / 2.f, viewSize), sounds, 1)
+{
+}
+
+/**
+ * Constructor shared by the windowed and the headless World class.
+ * @param window a pointer to the window of the game, nullptr if headless.
+ * @param view a sf::View object indicates the initial view.
+ * @param sounds a SoundPlayer object indicates the player of all sound effects.
+ * @param playerCount a std::size_t indicates the number of player aircraft.
  */
-World::World(sf::RenderWindow& window)
+World::World(sf::RenderWindow* window, const sf::View& view, SoundPlayer& sounds, std::size_t playerCount)
     : mWindow(window)
-    , mWorldView(window.getDefaultView())
+    , mSounds(sounds)
+    , mWorldView(view)
+    , mViewCenter()
+    , mLevel(LevelPath)
     , mTextures()
+    , mBackgroundTile()
     , mSceneGraph()
     , mSceneLayers()
-    // We initialize view height to be 2000(just an arbitrary number).
-    , mWorldBounds(0.f, 0.f, mWorldView.getSize().x, 2000.f)
+    // The level gives the height of the world.
+    , mWorldBounds(0.f, 0.f, mWorldView.getSize().x, mLevel.getHeader().worldHeight)
     // Set player's plane's beginning position.
     , mSpawnPosition(mWorldView.getSize().x / 2.f, mWorldBounds.height - mWorldView.getSize().y / 2.f)
     // Scroll move upward.
-    , mScrollSpeed(-50.f)
-    , mPlayerAircraft(nullptr)
+    , mScrollSpeed(toScalar(-mLevel.getHeader().scrollSpeed))
+    , mBackground(nullptr)
+    , mPlayerAircraft(playerCount, nullptr)
+    , mEscorts()
+    , mPlayerActions(playerCount, 0)
+    , mNextSpawn(0)
+    , mEnemies(nullptr)
+    , mParticleSystems()
+    , mProjectiles(nullptr)
+    , mCollisions()
+    , mEffectsEnabled(true)
+    , mEffectsThrottled(false)
+    , mWrecks()
+    , mExplosions()
 {
+  assert(playerCount > 0);
+
+  // Aircraft collide with the aircraft and projectiles of the other side.
+  mCollisions.allowPair(Category::PlayerAircraft, Category::EnemyAircraft | Category::EnemyProjectile);
+  mCollisions.allowPair(Category::EnemyAircraft, Category::AlliedProjectile);
+  mCollisions.allowPair(Category::AlliedAircraft, Category::EnemyAircraft | Category::EnemyProjectile);
+
+  // Set view center initially matching the player's spawn position, the background starts from it.
+  mViewCenter = toScalar(mSpawnPosition);
+  mWorldView.setCenter(toFloat(mViewCenter));
+
   // Call two methods for further initialization.
   loadTextures();
   buildScene();
 
-  // Set view center initially matching the player's spawn position.
-  mWorldView.setCenter(mSpawnPosition);
+  // Every body of a tick fits into the collision system, and one pair per body is plenty(a pair always holds an
+  // aircraft), so handling collisions never allocates.
+  const std::size_t enemyCount = std::min<std::size_t>(mLevel.getHeader().enemyCount, MaxReservedEnemies);
+  const std::size_t bodyCount = MaxProjectiles + enemyCount + mPlayerAircraft.size() + mEscorts.size();
+  mCollisions.reserve(bodyCount, bodyCount);
+  // Every aircraft can explode during the same tick.
+  mExplosions.reserve(enemyCount + mPlayerAircraft.size() + mEscorts.size());
 }
 
 /**
@@ -40,21 +140,39 @@ World::World(sf::RenderWindow& window)
 void World::update(sf::Time dt)
 {
   // Scroll the world in y axis direction(texture move from top to bottom) per delta time.
-  mWorldView.move(0.f, mScrollSpeed * dt.asSeconds());
+  mViewCenter.y += mScrollSpeed * toScalar(dt);
+  mWorldView.setCenter(toFloat(mViewCenter));
+  if (mBackground)
+    mBackground -> setVisibleArea(getViewBounds());
 
-  // Reset the player's velocity to (0, 0).
-  mPlayerAircraft -> setVelocity(0.f, 0.f);
+  // Only the part of the level around the view is in the scene graph, so a tick costs the same anywhere.
+  removeOffscreenEnemies();
+  activateEnemies();
+
+  // Reset the players' velocity to (0, 0).
+  for (Aircraft* aircraft : mPlayerAircraft)
+    aircraft -> setVelocity(Vector2s());
 
   // Forward commands to scene graph, adapt velocity (scrolling, diagonal correction).
   while (!mCommandQueue.isEmpty())
     mSceneGraph.onCommand(mCommandQueue.pop(), dt);
+  applyPlayerActions();
 
   // Check and fix diagonal movement situations.
   this -> adaptPlayerVelocity();
 
   // Regular update step, adapt position (correct if outside view)
+  mProjectiles -> setBounds(getBattlefieldBounds());
   mSceneGraph.update(dt);
+  emitExhaust(dt);
   this -> adaptPlayerPosition();
+  launchProjectiles(dt);
+  handleCollisions();
+  // Everything destroyed during this tick leaves the scene graph at once.
+  removeWrecks();
+
+  // Sound effects are heard from the center of the screen.
+  mSounds.setListenerPosition(mWorldView.getCenter());
 }
 
 /**
@@ -62,10 +180,11 @@ void World::update(sf::Time dt)
  */
 void World::draw()
 {
+  assert(mWindow);
   // Set window's view.
-  mWindow.setView(mWorldView);
+  mWindow -> setView(mWorldView);
   // Draw all drawable objects to the window.
-  mWindow.draw(mSceneGraph);
+  mWindow -> draw(mSceneGraph);
 }
 
 /**
@@ -77,6 +196,186 @@ CommandQueue& World::getCommandQueue()
   return this -> mCommandQueue;
 }
 
+/**
+ * Set the actions one player's aircraft takes during the next update, in addition to the commands. This is how
+ * players other than the local one are steered, e.g. from input received over the network.
+ * @param player a std::size_t indicates the index of the player.
+ * @param actions an unsigned int with the bit (1 << action) set for each Player::Action taken.
+ */
+void World::setPlayerActions(std::size_t player, unsigned int actions)
+{
+  assert(player < mPlayerActions.size());
+  mPlayerActions[player] = actions;
+}
+
+/**
+ * Save the simulation state: the view, the next spawn of the level, the player aircraft, then the enemy entities and the
+ * projectiles as packed arrays, so no scene graph is walked. Only the first save of a state allocates. The state of
+ * escorts is not saved, so only worlds without them(the ones with several players) can be restored faithfully.
+ * Particles are effects and not part of the state.
+ * @param state a State object receiving the state.
+ */
+void World::saveState(State& state) const
+{
+  state.viewCenter = mViewCenter;
+  state.nextSpawn = mNextSpawn;
+  state.players.resize(mPlayerAircraft.size());
+  for (std::size_t i = 0; i < mPlayerAircraft.size(); ++i)
+    mPlayerAircraft[i] -> saveState(state.players[i]);
+  mEnemies -> getRegistry().saveState(state.enemies);
+  mProjectiles -> saveState(state.projectiles);
+}
+
+/**
+ * Bring the simulation state back from a state saved by this world, e.g. to simulate ticks again with corrected
+ * input. Commands and actions set since are dropped.
+ * @param state a State object indicates the saved state.
+ */
+void World::restoreState(const State& state)
+{
+  assert(state.players.size() == mPlayerAircraft.size());
+
+  while (!mCommandQueue.isEmpty())
+    mCommandQueue.pop();
+  std::fill(mPlayerActions.begin(), mPlayerActions.end(), 0);
+
+  mViewCenter = state.viewCenter;
+  mWorldView.setCenter(toFloat(mViewCenter));
+  mNextSpawn = state.nextSpawn;
+  for (std::size_t i = 0; i < mPlayerAircraft.size(); ++i)
+    mPlayerAircraft[i] -> restoreState(state.players[i]);
+  mEnemies -> restoreState(state.enemies);
+  mProjectiles -> restoreState(state.projectiles);
+}
+
+/**
+ * Switch particle and sound effects on or off. They are off while ticks which were already shown are simulated
+ * again, so that their exhaust, explosions and gunfire are not spawned twice.
+ * @param isEnabled a bool value indicates whether particles are spawned and sounds played.
+ */
+void World::setEffectsEnabled(bool isEnabled)
+{
+  mEffectsEnabled = isEnabled;
+  applyEffectSettings();
+}
+
+/**
+ * Throttle the cosmetic simulation, which the game does while its updates eat most of the frame budget. Exhaust is
+ * no longer spawned, particles are integrated every ThrottledParticleInterval ticks and the background only requests
+ * the chunks the view shows. Explosions, and everything the simulation state depends on, are left alone.
+ * @param isThrottled a bool value indicates whether the cosmetic simulation is throttled.
+ */
+void World::setEffectsThrottled(bool isThrottled)
+{
+  if (isThrottled == mEffectsThrottled)
+    return;
+
+  mEffectsThrottled = isThrottled;
+  applyEffectSettings();
+}
+
+/**
+ * Write the whole game into a saved game: the view, the next spawn of the level, every aircraft node(type, position relative
+ * to its parent, velocity and weapon), the components of every enemy entity column by column, then the projectiles.
+ * Textures are written as their resource IDs. Everything is copied into the save's buffer, which keeps its room
+ * between saves, so saving takes far less than a frame; hand the save to a SaveGameWriter to write the file.
+ * @param save a SaveGame object indicates the save, it is cleared first.
+ */
+void World::saveGame(SaveGame& save)
+{
+  save.clear();
+  save.write(mViewCenter);
+  save.write(static_cast<std::uint32_t>(mNextSpawn));
+
+  save.write(static_cast<std::uint32_t>(mPlayerAircraft.size()));
+  for (const Aircraft* aircraft : mPlayerAircraft)
+    writeAircraft(save, *aircraft);
+  save.write(static_cast<std::uint32_t>(mEscorts.size()));
+  for (const Aircraft* escort : mEscorts)
+    writeAircraft(save, *escort);
+
+  writeEnemies(save);
+  mProjectiles -> save(save);
+}
+
+/**
+ * Replace the game by a saved game. The players' aircraft and the nodes of the scene are kept and take the saved
+ * state, escorts and enemy entities are created again from the save. Particles of the abandoned game are cleared.
+ * If the save turns out not to fit this world, the world is reset and the exception is passed on.
+ * @param save a SaveGame object indicates the save.
+ */
+void World::loadGame(SaveGame& save)
+{
+  save.rewind();
+  try
+  {
+    readGame(save);
+  }
+  catch (...)
+  {
+    reset();
+    throw;
+  }
+}
+
+/**
+ * Rebuild the game world to its initial state while keeping the loaded textures, so that a cached game state
+ * can start a new round without reloading anything from disk.
+ */
+void World::reset()
+{
+  // Drop the commands left from the previous round.
+  while (!mCommandQueue.isEmpty())
+    mCommandQueue.pop();
+
+  // Destroy every layer together with all nodes attached to it.
+  for (SceneNode* layer : mSceneLayers)
+    mSceneGraph.detachChild(*layer);
+
+  // Move the view back to the spawn position and build the scene again.
+  mViewCenter = toScalar(mSpawnPosition);
+  mWorldView.setCenter(toFloat(mViewCenter));
+  buildScene();
+}
+
+/**
+ * Compute a checksum of the simulation state: the view, the next spawn of the level, then the position, velocity and
+ * category of every game object in scene graph order. Two worlds fed the same input give the same checksum after
+ * every tick unless an update path changed the simulation. Particles and the background are cosmetic and left out.
+ * @return a 64-bit integer indicates the checksum.
+ */
+std::uint64_t World::computeChecksum()
+{
+  StateHash hash;
+  hash.addVector(mViewCenter);
+  hash.addInteger(mNextSpawn);
+  mSceneGraph.hashState(hash);
+  return hash.getValue();
+}
+
+/**
+ * Write the visible state of every game object into a snapshot: the view, then the category and world position of
+ * every aircraft, enemy and projectile in scene graph order.
+ * @param snapshot a Snapshot object indicates where the state is written to(its tick is kept).
+ */
+void World::writeSnapshot(Snapshot& snapshot)
+{
+  snapshot.clear(mWorldView.getCenter());
+  mSceneGraph.writeSnapshot(snapshot);
+}
+
+/**
+ * Hand all loaded textures over, so that they can be released on the main thread while the rest of the world
+ * is destroyed elsewhere. The world must not be drawn afterwards.
+ * @param textures a vector receiving the unique_ptr of each texture.
+ */
+void World::releaseTextures(std::vector<std::unique_ptr<sf::Texture>>& textures)
+{
+  mTextures.releaseAll(textures);
+  if (mBackground)
+    mBackground -> releaseTextures(textures);
+}
+
 /**
  * Load all textures we need for the game world.
  */
@@ -84,13 +383,51 @@ void World::loadTextures()
 {
   mTextures.load(Textures::Eagle, "../Media/Textures/Eagle.png");
   mTextures.load(Textures::Raptor, "../Media/Textures/Raptor.png");
-  mTextures.load(Textures::Desert, "../Media/Textures/Desert.png");
+
+  // The background is generated from the pixels of the level's tile, so it is kept as an image.
+  const std::string backgroundTile = mLevel.getBackgroundTile();
+  if (!mBackgroundTile.loadFromFile(backgroundTile))
+    throw std::runtime_error("World::loadTextures - Failed to load " + backgroundTile);
 }
 
 /**
  * Build the whole game world(scene).
  */
 void World::buildScene()
+{
+  buildLayers();
+
+  // Add the players' aircraft side by side, centered on the spawn position.
+  for (std::size_t i = 0; i < mPlayerAircraft.size(); ++i)
+  {
+    // First create a Aircraft object
+    std::unique_ptr<Aircraft> leader(new Aircraft(Aircraft::Eagle, mTextures));
+    mPlayerAircraft[i] = leader.get();
+    // Set Aircraft object's beginning position(the spawn position of world for a single player).
+    float offset = (i - (mPlayerAircraft.size() - 1) / 2.f) * PlayerSpacing;
+    leader -> setSimulatedPosition(toScalar(mSpawnPosition + sf::Vector2f(offset, 0.f)));
+    // Set Aircraft object's speed(x direction speed is 40 to the right and y direction speed is same as scroll's speed).
+    leader -> setVelocity(toScalar(40.f), mScrollSpeed);
+    addExhaust(*leader);
+    // Attach Aircraft as a child of air layer.
+    mSceneLayers[Air] -> attachChild(std::move(leader));
+  }
+
+  // Several players fly without escorts.
+  mEscorts.clear();
+  if (mPlayerAircraft.size() == 1)
+    addEscorts(*mPlayerAircraft.front());
+
+  addSystems();
+
+  // The enemies of the level appear as the view scrolls.
+  reserveEnemies();
+}
+
+/**
+ * Build the layers with the background and one node per particle type, which every scene starts from.
+ */
+void World::buildLayers()
 {
   // First, initialize different layers.
   for (std::size_t i = 0; i < LayerCount; ++i)
@@ -103,45 +440,656 @@ void World::buildScene()
     mSceneGraph.attachChild(std::move(layer));
   }
 
-  // Prepare the tiled background
-  sf::Texture& texture = mTextures.get(Textures::Desert);
-  // create a texture rect (with int coordinates) using the conversion from the world bounds
-  // (which have the type sf::FloatRect and thus store float coordinates).
-  sf::IntRect textureRect(mWorldBounds);
-  // Enable the texture object to repeat itself.
-  texture.setRepeated(true);
-
-  // Add the background sprite to the scene
-  // Create a new SpriteNode for background.
-  std::unique_ptr<SpriteNode> backgroundSprite(new SpriteNode(texture, textureRect));
-  // Set the beginning position of background.
-  backgroundSprite -> setPosition(mWorldBounds.left, mWorldBounds.top);
-  // Attach background sprite node as a child of background layer.
-  mSceneLayers[Background] -> attachChild(std::move(backgroundSprite));
-
-  // Add player's aircraft
-  // First create a Aircraft object
-  std::unique_ptr<Aircraft> leader(new Aircraft(Aircraft::Eagle, mTextures));
-  mPlayerAircraft = leader.get();
-  // Set Aircraft object's beginning position(just the spawn position of world).
-  mPlayerAircraft -> setPosition(mSpawnPosition);
-  // Set Aircraft object's speed(x direction speed is 40 to the right and y direction speed is same as scroll's speed).
-  mPlayerAircraft -> setVelocity(40.f, mScrollSpeed);
-  // Attach Aircraft as a child of air layer.
-  mSceneLayers[Air] -> attachChild(std::move(leader));
-
-  // Add two escorting aircrafts, placed relatively to the main plane.
-  std::unique_ptr<Aircraft> leftEscort(new Aircraft(Aircraft::Raptor, mTextures));
-  // Set left escorting aircraft beginning position(here position is relative to leader).
-  leftEscort -> setPosition(-80.f, 50.f);
-  // Attach left escorting aircraft to be one child.
-  mPlayerAircraft -> attachChild(std::move(leftEscort));
-
-  std::unique_ptr<Aircraft> rightEscort(new Aircraft(Aircraft::Raptor, mTextures));
-  // Set right escorting aircraft beginning position(here position is relative to leader).
-  rightEscort -> setPosition(80.f, 50.f);
-  // Attach right escorting aircraft to be one child.
-  mPlayerAircraft -> attachChild(std::move(rightEscort));
+  // Add the background, streamed chunk by chunk upward from the bottom of the world(nobody sees it if headless).
+  mBackground = nullptr;
+  if (mWindow)
+  {
+    sf::Vector2u chunkSize(static_cast<unsigned int>(mWorldView.getSize().x),
+                           static_cast<unsigned int>(mWorldView.getSize().y));
+    std::unique_ptr<BackgroundStreamer> background(new BackgroundStreamer(mBackgroundTile, chunkSize,
+                                                                          mWorldBounds.top + mWorldBounds.height,
+                                                                          BackgroundChunkCount, getViewBounds()));
+    mBackground = background.get();
+    // Attach the background as a child of background layer.
+    mSceneLayers[Background] -> attachChild(std::move(background));
+  }
+
+  // Add one node per particle type below the aircraft, the emitters attached to the aircraft feed them.
+  for (std::size_t i = 0; i < ParticleSystem::TypeCount; ++i)
+  {
+    std::unique_ptr<ParticleSystem> particles(new ParticleSystem(static_cast<ParticleSystem::Type>(i),
+                                                                 MaxParticles));
+    mParticleSystems[i] = particles.get();
+    mSceneLayers[LowerAir] -> attachChild(std::move(particles));
+  }
+  // The new nodes start with the effect settings of the old ones.
+  applyEffectSettings();
+}
+
+/**
+ * Add the nodes holding every enemy entity and every projectile above the aircraft.
+ */
+void World::addSystems()
+{
+  // Add the node holding every enemy as an entity.
+  std::unique_ptr<EntitySystemNode> enemies(new EntitySystemNode());
+  mEnemies = enemies.get();
+  mSceneLayers[Air] -> attachChild(std::move(enemies));
+
+  // Add the node holding every projectile, it draws on top of the aircraft.
+  std::unique_ptr<ProjectileSystem> projectiles(new ProjectileSystem(MaxProjectiles));
+  mProjectiles = projectiles.get();
+  mSceneLayers[Air] -> attachChild(std::move(projectiles));
+}
+
+/**
+ * Add the escorts of the level, placed relatively to the main plane by the level's escort formation.
+ * @param leader an Aircraft object indicates the aircraft escorted.
+ */
+void World::addEscorts(Aircraft& leader)
+{
+  const LevelFile::Header& header = mLevel.getHeader();
+  if (header.escortFormation == LevelFile::NoFormation)
+    return;
+
+  const LevelFile::Formation& formation = mLevel.getFormation(header.escortFormation);
+  for (std::size_t i = formation.firstOffset; i < formation.firstOffset + formation.offsetCount; ++i)
+  {
+    const LevelFile::Offset& offset = mLevel.getOffset(i);
+    std::unique_ptr<Aircraft> escort(new Aircraft(static_cast<Aircraft::Type>(header.escortType), mTextures));
+    // Escorts fly on the player's side whatever their type.
+    escort -> setCategory(Category::AlliedAircraft);
+    // Set escorting aircraft beginning position(here position is relative to leader).
+    escort -> setSimulatedPosition(toScalar(sf::Vector2f(offset.x, offset.y)));
+    addExhaust(*escort);
+    mEscorts.push_back(escort.get());
+    // Attach escorting aircraft to be one child.
+    leader.attachChild(std::move(escort));
+  }
+}
+
+/**
+ * Make room for the enemies of the level. They only become entities once the view approaches their spawn, so they
+ * cost nothing per tick before. Room for all of them(up to MaxReservedEnemies) is reserved now, so that no
+ * allocation happens once the round is running; the level file gives their number without reading its spawns.
+ */
+void World::reserveEnemies()
+{
+  // Every spawn starts dormant.
+  mNextSpawn = 0;
+
+  const std::size_t count = std::min<std::size_t>(mLevel.getHeader().enemyCount, MaxReservedEnemies);
+  EntityRegistry& registry = mEnemies -> getRegistry();
+  registry.reserve(count);
+  registry.reserveArchetype<Components::Position, Components::Velocity, Components::Sprite, Components::Collider,
+                            Components::RingWeapon, Components::Exhaust>(count);
+  for (int type = 0; type < Aircraft::TypeCount; ++type)
+    mEnemies -> reserveTexture(mTextures.get(toTextureID(static_cast<Aircraft::Type>(type))), count);
+  mWrecks.reserve(count);
+}
+
+/**
+ * Create the entity of an enemy. Enemies face the player, fire rings of projectiles and leave an exhaust trail.
+ * @param type a enum indicates the type of the enemy aircraft.
+ * @param position a Vector2s indicates the position of the enemy.
+ */
+void World::createEnemy(Aircraft::Type type, Vector2s position)
+{
+  const sf::Texture& texture = mTextures.get(toTextureID(type));
+  const sf::Vector2u size = texture.getSize();
+
+  Components::Position center = { position.x, position.y };
+  Components::Velocity velocity = { toScalar(0.f), toScalar(0.f) };
+  Components::Sprite sprite = { &texture, sf::IntRect(0, 0, size.x, size.y), 180.f };
+  Components::Collider collider = { size.x / 2.f, size.y / 2.f, Category::EnemyAircraft };
+  Components::RingWeapon weapon = { toScalar(0.f), toScalar(EnemyFireInterval), toScalar(EnemyProjectileSpeed),
+                                    EnemyRingSize };
+  Components::Exhaust exhaust = { ExhaustOffset, 0.f, 1.f / ExhaustRate };
+  mEnemies -> getRegistry().create(center, velocity, sprite, collider, weapon, exhaust);
+}
+
+/**
+ * Attach an exhaust emitter behind an aircraft, it follows the aircraft's movement and rotation.
+ * @param aircraft an Aircraft object indicates the aircraft leaving the exhaust trail.
+ */
+void World::addExhaust(Aircraft& aircraft)
+{
+  std::unique_ptr<EmitterNode> exhaust(new EmitterNode(*mParticleSystems[ParticleSystem::Exhaust], ExhaustRate));
+  exhaust -> setPosition(0.f, ExhaustOffset);
+  aircraft.attachChild(std::move(exhaust));
+}
+
+/**
+ * Create the entities of the spawns the scrolling view has come close to. The spawns are sorted by distance, so
+ * only the next one is compared and each spawn of the mapped level is read once. A formation appears as a whole
+ * once its anchor is close enough.
+ */
+void World::activateEnemies()
+{
+  const Scalar activationTop = mViewCenter.y - toScalar(mWorldView.getSize().y / 2.f + ActivationMargin);
+
+  for (; mNextSpawn < mLevel.getSpawnCount(); ++mNextSpawn)
+  {
+    const LevelFile::Spawn& spawn = mLevel.getSpawn(mNextSpawn);
+    const sf::Vector2f anchor(mSpawnPosition.x + spawn.x, mSpawnPosition.y - spawn.distance);
+    if (toScalar(anchor.y) <= activationTop)
+      break;
+
+    const LevelFile::Formation& formation = mLevel.getFormation(spawn.formation);
+    for (std::size_t i = formation.firstOffset; i < formation.firstOffset + formation.offsetCount; ++i)
+    {
+      const LevelFile::Offset& offset = mLevel.getOffset(i);
+      createEnemy(static_cast<Aircraft::Type>(spawn.type), toScalar(anchor + sf::Vector2f(offset.x, offset.y)));
+    }
+  }
+}
+
+/**
+ * Flag the enemies the view has scrolled past for removal, they can never come back into view.
+ */
+void World::removeOffscreenEnemies()
+{
+  const Scalar removalBottom = mViewCenter.y + toScalar(mWorldView.getSize().y / 2.f + RemovalMargin);
+
+  // They are removed with everything else destroyed during this tick.
+  EntityRegistry& registry = mEnemies -> getRegistry();
+  registry.each<Components::Position>(
+      [&registry, removalBottom] (std::size_t count, const EntityId* entities, Components::Position* positions)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      if (positions[i].y > removalBottom)
+        registry.destroy(entities[i]);
+    }
+  });
+}
+
+/**
+ * Launch the projectiles of the player and fire the weapons of every enemy entity whenever they are ready, with
+ * one gunfire sound per volley.
+ * @param dt a sf::Time object indicates the current frame time.
+ */
+void World::launchProjectiles(sf::Time dt)
+{
+  // Sounds are not played again while ticks which were already shown are simulated again.
+  SoundPlayer* sounds = mEffectsEnabled ? &mSounds : nullptr;
+  for (Aircraft* aircraft : mPlayerAircraft)
+    aircraft -> launchProjectiles(dt, *mProjectiles, sounds);
+
+  const Scalar seconds = toScalar(dt);
+  ProjectileSystem& projectiles = *mProjectiles;
+  const int priority = SoundPlayer::getPriority(SoundEffect::EnemyGunfire);
+  mEnemies -> getRegistry().each<Components::Position, Components::RingWeapon>(
+      [seconds, &projectiles, sounds, priority] (std::size_t count, const EntityId*, Components::Position* positions,
+                                                 Components::RingWeapon* weapons)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      Components::RingWeapon& weapon = weapons[i];
+      weapon.countdown -= seconds;
+      if (weapon.countdown > toScalar(0.f))
+        continue;
+
+      Vector2s position(positions[i].x, positions[i].y);
+      for (int j = 0; j < weapon.projectileCount; ++j)
+      {
+        // Directions are computed in double and rounded once, so that they are the same on every build.
+        double angle = 2.0 * RingPi * j / weapon.projectileCount;
+        Vector2s direction(toScalar(std::cos(angle)), toScalar(std::sin(angle)));
+        projectiles.spawn(ProjectileSystem::Enemy, position, direction * weapon.projectileSpeed);
+      }
+      weapon.countdown += weapon.interval;
+
+      if (sounds)
+        sounds -> play(SoundEffect::EnemyGunfire, toFloat(position), priority);
+    }
+  });
+}
+
+/**
+ * Spawn the exhaust particles of every enemy entity, behind the enemy along its rotation.
+ * @param dt a sf::Time object indicates the current frame time.
+ */
+void World::emitExhaust(sf::Time dt)
+{
+  const float seconds = dt.asSeconds();
+  ParticleSystem& particles = *mParticleSystems[ParticleSystem::Exhaust];
+  mEnemies -> getRegistry().each<Components::Position, Components::Sprite, Components::Exhaust>(
+      [seconds, &particles] (std::size_t count, const EntityId*, Components::Position* positions,
+                             Components::Sprite* sprites, Components::Exhaust* exhausts)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      Components::Exhaust& exhaust = exhausts[i];
+      const float radians = sprites[i].rotation * Pi / 180.f;
+      // The local offset(0, offset) rotated like the sprite.
+      sf::Vector2f position(toFloat(positions[i].x) - exhaust.offset * std::sin(radians),
+                            toFloat(positions[i].y) + exhaust.offset * std::cos(radians));
+
+      exhaust.accumulated += seconds;
+      while (exhaust.accumulated >= exhaust.interval)
+      {
+        exhaust.accumulated -= exhaust.interval;
+        particles.spawn(position, sf::Vector2f(0.f, 0.f));
+      }
+    }
+  });
+}
+
+/**
+ * Check whether a pair of collision bodies matches two categories, and swap them so that the first body is the one
+ * of the first category.
+ * @param first a pointer to the first body of the pair.
+ * @param second a pointer to the second body of the pair.
+ * @param firstCategory an unsigned int indicates the category the first body must have.
+ * @param secondCategory an unsigned int indicates the category the second body must have.
+ * @return a bool value indicates whether the pair matches the categories(in any order).
+ */
+static bool matchesCategories(const CollisionSystem::Body*& first, const CollisionSystem::Body*& second,
+                              unsigned int firstCategory, unsigned int secondCategory)
+{
+  if ((first -> category & firstCategory) && (second -> category & secondCategory))
+    return true;
+
+  if ((first -> category & secondCategory) && (second -> category & firstCategory))
+  {
+    std::swap(first, second);
+    return true;
+  }
+  return false;
+}
+
+/**
+ * Find the pairs which collide and flag what they destroy. Bodies are axis aligned rectangles, so the overlap
+ * found by the broadphase is already exact and no separate narrowphase is needed. Nothing is removed here.
+ */
+void World::handleCollisions()
+{
+  mCollisions.clear();
+  mSceneGraph.collectBodies(mCollisions);
+  const std::vector<CollisionSystem::Body>& bodies = mCollisions.getBodies();
+
+  for (const CollisionSystem::Pair& pair : mCollisions.findCandidatePairs())
+  {
+    const CollisionSystem::Body* first = &bodies[pair.first];
+    const CollisionSystem::Body* second = &bodies[pair.second];
+
+    if (matchesCategories(first, second, Category::EnemyAircraft, Category::AlliedProjectile))
+    {
+      // An allied projectile shoots an enemy down and is used up, unless it hit another one before.
+      if (mProjectiles -> isDestroyed(second -> index))
+        continue;
+      destroyAircraft(*first);
+      mProjectiles -> destroy(second -> index);
+    }
+    else if (matchesCategories(first, second, Category::PlayerAircraft, Category::EnemyAircraft))
+    {
+      // An enemy crashing into the player is destroyed.
+      destroyAircraft(*second);
+    }
+    else if (matchesCategories(first, second, Category::PlayerAircraft, Category::EnemyProjectile))
+    {
+      // An enemy projectile hitting the player is used up(the player is not hurt).
+      if (!mProjectiles -> isDestroyed(second -> index))
+        mProjectiles -> destroy(second -> index);
+    }
+    else if (matchesCategories(first, second, Category::AlliedAircraft, Category::EnemyAircraft))
+    {
+      // An escort and an enemy crashing into each other are both destroyed.
+      destroyAircraft(*first);
+      destroyAircraft(*second);
+    }
+    else if (matchesCategories(first, second, Category::AlliedAircraft, Category::EnemyProjectile))
+    {
+      // An enemy projectile shoots an escort down and is used up, unless it hit another one before.
+      if (mProjectiles -> isDestroyed(second -> index))
+        continue;
+      destroyAircraft(*first);
+      mProjectiles -> destroy(second -> index);
+    }
+  }
+}
+
+/**
+ * Flag the aircraft of a collision body for removal and queue its explosion, unless it is already flagged(several
+ * bodies can hit the same aircraft during one tick). The body belongs to an enemy entity or to an aircraft node.
+ * Explosions are only spawned by removeWrecks(), once every collision of the tick has been applied.
+ * @param body a Body object indicates the collision body of the aircraft which is destroyed.
+ */
+void World::destroyAircraft(const CollisionSystem::Body& body)
+{
+  sf::Vector2f position;
+  if (body.node == mEnemies)
+  {
+    EntityRegistry& registry = mEnemies -> getRegistry();
+    EntityId enemy = registry.getEntity(static_cast<std::uint32_t>(body.index));
+    if (registry.isDestroyed(enemy))
+      return;
+
+    registry.destroy(enemy);
+    const Components::Position& enemyPosition = registry.get<Components::Position>(enemy);
+    position = sf::Vector2f(toFloat(enemyPosition.x), toFloat(enemyPosition.y));
+  }
+  else
+  {
+    if (body.node -> isMarkedForRemoval())
+      return;
+
+    body.node -> destroy();
+    position = body.node -> getWorldPosition();
+  }
+
+  mExplosions.push_back(position);
+}
+
+/**
+ * Spawn the sparks and the sound of one explosion.
+ * @param position a sf::Vector2f indicates the world position of the explosion.
+ */
+void World::explode(sf::Vector2f position)
+{
+  // Sparks fly out in every direction at three different speeds.
+  ParticleSystem& explosion = *mParticleSystems[ParticleSystem::Explosion];
+  for (int i = 0; i < ExplosionParticleCount; ++i)
+  {
+    float angle = 2.f * Pi * i / ExplosionParticleCount;
+    float speed = ExplosionSpeed * (1.f - 0.25f * (i % 3));
+    explosion.spawn(position, speed * sf::Vector2f(std::cos(angle), std::sin(angle)));
+  }
+  if (mEffectsEnabled)
+    mSounds.play(SoundEffect::Explosion, position, SoundPlayer::getPriority(SoundEffect::Explosion));
+}
+
+/**
+ * Remove every flagged entity, node and projectile in one sweep, then destroy the removed nodes at once and let
+ * the aircraft destroyed during the tick explode.
+ */
+void World::removeWrecks()
+{
+  mProjectiles -> removeDestroyed();
+  mEnemies -> removeDestroyed();
+  // Escorts shot down are forgotten before their nodes go.
+  mEscorts.erase(std::remove_if(mEscorts.begin(), mEscorts.end(), [] (const Aircraft* escort)
+  { return escort -> isMarkedForRemoval(); }), mEscorts.end());
+  mSceneGraph.removeWrecks(mWrecks);
+  mWrecks.clear();
+
+  for (const sf::Vector2f& position : mExplosions)
+    explode(position);
+  mExplosions.clear();
+}
+
+/**
+ * Replace the game by the content of a saved game, after its header. Everything but the projectiles is read before
+ * the world is changed, so a save which does not fit this world mostly fails before anything is lost.
+ * @param save a SaveGame object indicates the save.
+ */
+void World::readGame(SaveGame& save)
+{
+  const Vector2s viewCenter = save.read<Vector2s>();
+  const std::size_t nextSpawn = save.read<std::uint32_t>();
+  if (nextSpawn > mLevel.getSpawnCount())
+    throw std::runtime_error("World::readGame - The saved game is further along than the level");
+
+  std::vector<SavedAircraft> players(save.read<std::uint32_t>());
+  if (players.size() != mPlayerAircraft.size())
+    throw std::runtime_error("World::readGame - The saved game has another number of players");
+  for (std::size_t i = 0; i < players.size(); ++i)
+  {
+    players[i] = readAircraft(save);
+    if (players[i].type != mPlayerAircraft[i] -> getType())
+      throw std::runtime_error("World::readGame - The saved game has another player aircraft");
+  }
+
+  const std::size_t escortCount = save.read<std::uint32_t>();
+  if (escortCount > 0 && mPlayerAircraft.size() > 1)
+    throw std::runtime_error("World::readGame - The saved game has escorts although there are several players");
+  std::vector<SavedAircraft> escorts;
+  for (std::size_t i = 0; i < escortCount; ++i)
+    escorts.push_back(readAircraft(save));
+
+  std::vector<SavedEnemy> enemies;
+  readEnemies(save, enemies);
+
+  // Drop what was going on, then move everything to the saved state.
+  while (!mCommandQueue.isEmpty())
+    mCommandQueue.pop();
+  std::fill(mPlayerActions.begin(), mPlayerActions.end(), 0);
+  for (ParticleSystem* particles : mParticleSystems)
+    particles -> clear();
+
+  mViewCenter = viewCenter;
+  mWorldView.setCenter(toFloat(mViewCenter));
+  if (mBackground)
+    mBackground -> setVisibleArea(getViewBounds());
+  mNextSpawn = nextSpawn;
+
+  for (std::size_t i = 0; i < players.size(); ++i)
+    mPlayerAircraft[i] -> restoreState(players[i].state);
+
+  // Escorts are created again like in buildScene(), relative to the first player.
+  for (Aircraft* escort : mEscorts)
+    escort -> destroy();
+  removeWrecks();
+  for (const SavedAircraft& saved : escorts)
+  {
+    std::unique_ptr<Aircraft> escort(new Aircraft(saved.type, mTextures));
+    escort -> setCategory(Category::AlliedAircraft);
+    escort -> restoreState(saved.state);
+    addExhaust(*escort);
+    mEscorts.push_back(escort.get());
+    mPlayerAircraft.front() -> attachChild(std::move(escort));
+  }
+
+  EntityRegistry& registry = mEnemies -> getRegistry();
+  registry.clear();
+  for (const SavedEnemy& enemy : enemies)
+    registry.create(enemy.position, enemy.velocity, enemy.sprite, enemy.collider, enemy.weapon, enemy.exhaust);
+  mEnemies -> writeBatches();
+
+  mProjectiles -> load(save);
+}
+
+/**
+ * Write an aircraft into a saved game: its type, then its position relative to its parent, velocity and weapon.
+ * @param save a SaveGame object indicates the save.
+ * @param aircraft an Aircraft object indicates the aircraft.
+ */
+void World::writeAircraft(SaveGame& save, const Aircraft& aircraft)
+{
+  Aircraft::State state;
+  aircraft.saveState(state);
+
+  save.write(static_cast<std::uint32_t>(aircraft.getType()));
+  save.write(state.position);
+  save.write(state.velocity);
+  save.write(static_cast<std::int64_t>(state.fireCountdown.asMicroseconds()));
+  save.write(static_cast<std::uint8_t>(state.isFiring));
+}
+
+/**
+ * Read an aircraft written by writeAircraft() from a saved game.
+ * @param save a SaveGame object indicates the save.
+ * @return a SavedAircraft object indicates the type and the state of the aircraft.
+ */
+World::SavedAircraft World::readAircraft(SaveGame& save)
+{
+  const std::uint32_t type = save.read<std::uint32_t>();
+  if (type >= Aircraft::TypeCount)
+    throw std::runtime_error("World::readAircraft - The saved game holds an unknown aircraft type");
+
+  SavedAircraft aircraft;
+  aircraft.type = static_cast<Aircraft::Type>(type);
+  aircraft.state.position = save.read<Vector2s>();
+  aircraft.state.velocity = save.read<Vector2s>();
+  aircraft.state.fireCountdown = sf::microseconds(save.read<std::int64_t>());
+  aircraft.state.isFiring = save.read<std::uint8_t>() != 0;
+  return aircraft;
+}
+
+/**
+ * Write the enemy entities into a saved game, one block per archetype: the number of entities, each component
+ * column with one copy, then the resource ID and texture rectangle of each sprite(the texture pointer cannot be
+ * saved). A block of zero entities ends the list. Every enemy entity has the same components.
+ * @param save a SaveGame object indicates the save.
+ */
+void World::writeEnemies(SaveGame& save)
+{
+  const TextureHolder& textures = mTextures;
+  mEnemies -> getRegistry().each<Components::Position, Components::Velocity, Components::Sprite,
+                                 Components::Collider, Components::RingWeapon, Components::Exhaust>(
+      [&save, &textures] (std::size_t count, const EntityId*, Components::Position* positions,
+                          Components::Velocity* velocities, Components::Sprite* sprites,
+                          Components::Collider* colliders, Components::RingWeapon* weapons,
+                          Components::Exhaust* exhausts)
+  {
+    save.write(static_cast<std::uint32_t>(count));
+    save.writeArray(positions, count);
+    save.writeArray(velocities, count);
+    save.writeArray(colliders, count);
+    save.writeArray(weapons, count);
+    save.writeArray(exhausts, count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      // Enemies are drawn with the texture of an aircraft type.
+      std::uint32_t texture = Textures::Eagle;
+      for (int type = 0; type < Aircraft::TypeCount; ++type)
+      {
+        Textures::ID id = toTextureID(static_cast<Aircraft::Type>(type));
+        if (&textures.get(id) == sprites[i].texture)
+          texture = id;
+      }
+      save.write(texture);
+      save.write(sprites[i].textureRect);
+      save.write(sprites[i].rotation);
+    }
+  });
+  save.write(static_cast<std::uint32_t>(0));
+}
+
+/**
+ * Read the enemy entities written by writeEnemies() from a saved game.
+ * @param save a SaveGame object indicates the save.
+ * @param enemies a vector receiving the components of each enemy.
+ */
+void World::readEnemies(SaveGame& save, std::vector<SavedEnemy>& enemies) const
+{
+  std::vector<Components::Position> positions;
+  std::vector<Components::Velocity> velocities;
+  std::vector<Components::Collider> colliders;
+  std::vector<Components::RingWeapon> weapons;
+  std::vector<Components::Exhaust> exhausts;
+
+  while (const std::size_t count = save.read<std::uint32_t>())
+  {
+    // Every entity takes more than one byte, a larger count can only come from a broken save.
+    if (count > save.getSize())
+      throw std::runtime_error("World::readEnemies - The saved game ends unexpectedly");
+
+    positions.resize(count);
+    velocities.resize(count);
+    colliders.resize(count);
+    weapons.resize(count);
+    exhausts.resize(count);
+    save.readArray(positions.data(), count);
+    save.readArray(velocities.data(), count);
+    save.readArray(colliders.data(), count);
+    save.readArray(weapons.data(), count);
+    save.readArray(exhausts.data(), count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const std::uint32_t texture = save.read<std::uint32_t>();
+      const sf::Texture* found = nullptr;
+      for (int type = 0; type < Aircraft::TypeCount; ++type)
+      {
+        Textures::ID id = toTextureID(static_cast<Aircraft::Type>(type));
+        if (id == texture)
+          found = &mTextures.get(id);
+      }
+      if (!found)
+        throw std::runtime_error("World::readEnemies - The saved game holds an unknown texture");
+
+      SavedEnemy enemy;
+      enemy.position = positions[i];
+      enemy.velocity = velocities[i];
+      enemy.sprite.texture = found;
+      enemy.sprite.textureRect = save.read<sf::IntRect>();
+      enemy.sprite.rotation = save.read<float>();
+      enemy.collider = colliders[i];
+      enemy.weapon = weapons[i];
+      enemy.exhaust = exhausts[i];
+      enemies.push_back(enemy);
+    }
+  }
+}
+
+/**
+ * Apply whether effects are enabled and whether the cosmetic simulation is throttled to the particle systems and
+ * the background.
+ */
+void World::applyEffectSettings()
+{
+  for (ParticleSystem* particles : mParticleSystems)
+  {
+    bool isCosmetic = particles -> getType() == ParticleSystem::Exhaust;
+    particles -> setEmitting(mEffectsEnabled && !(mEffectsThrottled && isCosmetic));
+    particles -> setUpdateInterval(mEffectsThrottled ? ThrottledParticleInterval : 1);
+  }
+  if (mBackground)
+    mBackground -> setPrefetching(!mEffectsThrottled);
+}
+
+/**
+ * Get the visible area of the world.
+ * @return a sf::FloatRect indicates the area the view currently shows.
+ */
+sf::FloatRect World::getViewBounds() const
+{
+  return sf::FloatRect(mWorldView.getCenter() - mWorldView.getSize() / 2.f, mWorldView.getSize());
+}
+
+/**
+ * Get the area around the view where game objects are still simulated.
+ * @return a sf::FloatRect indicates the view bounds grown by BattlefieldMargin on every side.
+ */
+sf::FloatRect World::getBattlefieldBounds() const
+{
+  sf::FloatRect bounds = getViewBounds();
+  bounds.left -= BattlefieldMargin;
+  bounds.top -= BattlefieldMargin;
+  bounds.width += 2.f * BattlefieldMargin;
+  bounds.height += 2.f * BattlefieldMargin;
+  return bounds;
+}
+
+/**
+ * Steer the player aircraft according to the actions set for them, like the commands of the Player class would,
+ * then clear the actions.
+ */
+void World::applyPlayerActions()
+{
+  for (std::size_t i = 0; i < mPlayerAircraft.size(); ++i)
+  {
+    const unsigned int actions = mPlayerActions[i];
+    Aircraft& aircraft = *mPlayerAircraft[i];
+    Vector2s direction;
+
+    if (actions & (1u << Player::MoveLeft))
+      direction.x -= toScalar(1.f);
+    if (actions & (1u << Player::MoveRight))
+      direction.x += toScalar(1.f);
+    if (actions & (1u << Player::MoveUp))
+      direction.y -= toScalar(1.f);
+    if (actions & (1u << Player::MoveDown))
+      direction.y += toScalar(1.f);
+    aircraft.accelerate(direction * aircraft.getMaxSpeed());
+
+    if (actions & (1u << Player::Fire))
+      aircraft.fire();
+    mPlayerActions[i] = 0;
+  }
 }
 
 /**
@@ -149,15 +1097,18 @@ void World::buildScene()
  */
 void World::adaptPlayerVelocity()
 {
-  // Get current player's velocity.
-  sf::Vector2f velocity = mPlayerAircraft -> getVelocity();
+  for (Aircraft* aircraft : mPlayerAircraft)
+  {
+    // Get current player's velocity.
+    Vector2s velocity = aircraft -> getVelocity();
 
-  // If moving diagonally, reduce velocity (to have always same velocity)
-  if (velocity.x != 0.f && velocity.y != 0.f)
-    mPlayerAircraft -> setVelocity(velocity / std::sqrt(2.f));
+    // If moving diagonally, reduce velocity (to have always same velocity)
+    if (velocity.x != toScalar(0.f) && velocity.y != toScalar(0.f))
+      aircraft -> setVelocity(velocity * toScalar(InverseSqrt2));
 
-  // Add scrolling velocity(so that plane will stay at the same position if no movements involved).
-  mPlayerAircraft -> accelerate(0.f, mScrollSpeed);
+    // Add scrolling velocity(so that plane will stay at the same position if no movements involved).
+    aircraft -> accelerate(toScalar(0.f), mScrollSpeed);
+  }
 }
 
 /**
@@ -166,18 +1117,24 @@ void World::adaptPlayerVelocity()
 void World::adaptPlayerPosition()
 {
   // Keep player's position inside the screen bounds, at least borderDistance units from the border
-  sf::FloatRect viewBounds(mWorldView.getCenter() - mWorldView.getSize() / 2.f, mWorldView.getSize());
+  const sf::Vector2f viewSize = mWorldView.getSize();
 
   // Least distance between view bound.
   const float borderDistance = 40.f;
 
-  // Get player's current position.
-  sf::Vector2f position = mPlayerAircraft -> getPosition();
+  // Reach of the player from the view center in each direction.
+  const Vector2s reach = toScalar(viewSize / 2.f - sf::Vector2f(borderDistance, borderDistance));
+
+  for (Aircraft* aircraft : mPlayerAircraft)
+  {
+    // Get player's current position.
+    Vector2s position = aircraft -> getSimulatedPosition();
 
-  // Set player's position inside the screen bounds.
-  position.x = std::max(position.x, viewBounds.left + borderDistance);
-  position.x = std::min(position.x, viewBounds.left + viewBounds.width - borderDistance);
-  position.y = std::max(position.y, viewBounds.top + borderDistance);
-  position.y = std::min(position.y, viewBounds.top + viewBounds.height - borderDistance);
-  mPlayerAircraft -> setPosition(position);
+    // Set player's position inside the screen bounds.
+    position.x = std::max(position.x, mViewCenter.x - reach.x);
+    position.x = std::min(position.x, mViewCenter.x + reach.x);
+    position.y = std::max(position.y, mViewCenter.y - reach.y);
+    position.y = std::min(position.y, mViewCenter.y + reach.y);
+    aircraft -> setSimulatedPosition(position);
+  }
 }
\ No newline at end of file
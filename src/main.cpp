@@ -1,13 +1,133 @@
 // Include project header files
 #include "Application.hpp"
+#include "CollisionBenchmark.hpp"
+#include "ChecksumLog.hpp"
+#include "GameServer.hpp"
+#include "ClientApplication.hpp"
+#include "NetworkBenchmark.hpp"
+#include "RollbackApplication.hpp"
+#include "SaveBenchmark.hpp"
+#include "StateBenchmark.hpp"
+#include "SoundBenchmark.hpp"
+#include "ProjectileBenchmark.hpp"
+#include "ParticleBenchmark.hpp"
+#include "LevelFile.hpp"
 
 // Include C++ standard headers.
 #include <iostream>
+#include <string>
+
+/**
+ * Get the port given on the command line.
+ * @param argc an int indicates the number of arguments.
+ * @param argv an array of the arguments.
+ * @param index an int indicates the index of the port argument.
+ * @return an unsigned short indicates the port, the default port if it is not given.
+ */
+static unsigned short getPortArgument(int argc, char* argv[], int index)
+{
+  return argc > index ? static_cast<unsigned short>(std::stoi(argv[index])) : Network::DefaultPort;
+}
 
 // Main entrance of the program
-int main() {
-  // Try to launch the game.
+int main(int argc, char* argv[]) {
+  // Measure the collision broadphase instead of launching the game.
+  if (argc > 1 && std::string(argv[1]) == "--benchmark-collisions")
+  {
+    CollisionBenchmark::run(std::cout);
+    return 0;
+  }
+
+  // Measure the particle update instead of launching the game.
+  if (argc > 1 && std::string(argv[1]) == "--benchmark-particles")
+  {
+    ParticleBenchmark::run(std::cout);
+    return 0;
+  }
+
+  // Compare two checksum logs and report the first tick where the runs diverge.
+  if (argc > 3 && std::string(argv[1]) == "--compare-checksums")
+  {
+    try {
+      return ChecksumLog::compare(argv[2], argv[3], std::cout) ? 0 : 1;
+    }
+    catch (std::exception& e)
+    {
+      std::cout << "\nEXCEPTION: " << e.what() << std::endl;
+      return 2;
+    }
+  }
+
+  // Compile the text description of a level into a level file: --compile-level source destination
+  if (argc > 3 && std::string(argv[1]) == "--compile-level")
+  {
+    try {
+      LevelFile::compile(argv[2], argv[3]);
+      return 0;
+    }
+    catch (std::exception& e)
+    {
+      std::cout << "\nEXCEPTION: " << e.what() << std::endl;
+      return 2;
+    }
+  }
+
+  // Try to launch the game(or the server, or a client of it).
   try {
+    // Measure the server with simulated clients over loopback.
+    if (argc > 1 && std::string(argv[1]) == "--benchmark-network")
+    {
+      NetworkBenchmark::run(std::cout);
+      return 0;
+    }
+    // Measure saving and loading the world.
+    if (argc > 1 && std::string(argv[1]) == "--benchmark-save")
+    {
+      SaveBenchmark::run(std::cout);
+      return 0;
+    }
+    // Measure pushing, popping and running states on each state stack.
+    if (argc > 1 && std::string(argv[1]) == "--benchmark-states")
+    {
+      StateBenchmark::run(std::cout);
+      return 0;
+    }
+    // Measure the sound player on the null output during a busy battle.
+    if (argc > 1 && std::string(argv[1]) == "--benchmark-sound")
+    {
+      SoundBenchmark::run(std::cout);
+      return 0;
+    }
+    // Measure ticks of the world with its view full of projectiles.
+    if (argc > 1 && std::string(argv[1]) == "--benchmark-projectiles")
+    {
+      ProjectileBenchmark::run(std::cout);
+      return 0;
+    }
+    // Run the world headlessly and send it to the clients: --server [port]
+    if (argc > 1 && std::string(argv[1]) == "--server")
+    {
+      GameServer server(getPortArgument(argc, argv, 2));
+      server.run(std::cout);
+      return 0;
+    }
+    // Show the world a server sends: --connect address [port]
+    if (argc > 2 && std::string(argv[1]) == "--connect")
+    {
+      ClientApplication client(sf::IpAddress(argv[2]), getPortArgument(argc, argv, 3));
+      client.run(std::cout);
+      return 0;
+    }
+    // Play against a second instance over loopback: --rollback player localPort remotePort [latencyMs]
+    if (argc > 4 && std::string(argv[1]) == "--rollback")
+    {
+      sf::Time latency = sf::milliseconds(argc > 5 ? std::stoi(argv[5]) : 0);
+      RollbackApplication game(static_cast<std::size_t>(std::stoi(argv[2])), getPortArgument(argc, argv, 3),
+                               getPortArgument(argc, argv, 4), latency);
+      game.run(std::cout);
+      return 0;
+    }
+
     Application app;
     app.run();
 